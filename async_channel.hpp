@@ -0,0 +1,360 @@
+#ifndef ASYNC_CHANNEL_HPP
+#define ASYNC_CHANNEL_HPP
+
+#include "circular_buffer.hpp"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+struct AsyncOperation {
+    AsyncOperation* next = nullptr;
+    std::coroutine_handle<> handle;
+};
+
+class AsyncOperationQueue {
+public:
+    [[nodiscard]] bool empty() const noexcept;
+    void push(AsyncOperation& operation) noexcept;
+    AsyncOperation& pop() noexcept;
+    AsyncOperation* release() noexcept;
+
+private:
+    AsyncOperation* head_ = nullptr;
+    AsyncOperation* tail_ = nullptr;
+};
+
+template<typename Executor>
+concept AsyncExecutor = requires(Executor& executor, AsyncOperation& operation) {
+    executor.schedule(operation);
+};
+
+class AsyncTask {
+public:
+    struct promise_type {
+        AsyncOperation operation;
+
+        AsyncTask get_return_object() noexcept {
+            return AsyncTask(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+
+    AsyncTask(AsyncTask&& other) noexcept;
+    AsyncTask& operator=(AsyncTask&& other) noexcept;
+    ~AsyncTask();
+
+    AsyncOperation& release() noexcept;
+
+private:
+    explicit AsyncTask(std::coroutine_handle<promise_type> handle) noexcept;
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+class EventLoop {
+public:
+    void schedule(AsyncOperation& operation) noexcept;
+    void spawn(AsyncTask task) noexcept;
+    std::size_t run();
+    [[nodiscard]] bool idle() const noexcept;
+
+private:
+    AsyncOperationQueue ready_;
+};
+
+template<typename T, AsyncExecutor Executor>
+class AsyncChannel {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    class PushAwaiter;
+    class PopAwaiter;
+
+    AsyncChannel(size_type capacity, Executor& executor);
+
+    AsyncChannel(const AsyncChannel&) = delete;
+    AsyncChannel& operator=(const AsyncChannel&) = delete;
+
+    [[nodiscard]] PushAwaiter push(T value);
+    [[nodiscard]] PopAwaiter pop();
+    [[nodiscard]] bool try_push(T& value);
+    [[nodiscard]] std::optional<T> try_pop();
+    void close();
+
+    [[nodiscard]] bool closed() const;
+    [[nodiscard]] size_type size() const;
+    [[nodiscard]] size_type capacity() const noexcept;
+
+private:
+    CircularBuffer<T, ModuloCapacity, std::allocator<T>, RejectNewest> buffer_;
+    Executor& executor_;
+    AsyncOperationQueue pushers_;
+    AsyncOperationQueue poppers_;
+    mutable std::mutex mutex_;
+    bool closed_;
+
+    bool deliver(T& value, std::unique_lock<std::mutex>& lock);
+    bool receive(std::optional<T>& value, std::unique_lock<std::mutex>& lock);
+    void schedule_all(AsyncOperation* operation) noexcept;
+};
+
+template<typename T, AsyncExecutor Executor>
+class AsyncChannel<T, Executor>::PushAwaiter : public AsyncOperation {
+public:
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    bool await_resume() const noexcept { return accepted_; }
+
+private:
+    friend class AsyncChannel;
+
+    PushAwaiter(AsyncChannel& channel, T value);
+
+    AsyncChannel& channel_;
+    T value_;
+    bool accepted_;
+};
+
+template<typename T, AsyncExecutor Executor>
+class AsyncChannel<T, Executor>::PopAwaiter : public AsyncOperation {
+public:
+    bool await_ready() const noexcept { return false; }
+    bool await_suspend(std::coroutine_handle<> handle);
+    std::optional<T> await_resume() noexcept(std::is_nothrow_move_constructible_v<T>) { return std::move(value_); }
+
+private:
+    friend class AsyncChannel;
+
+    explicit PopAwaiter(AsyncChannel& channel) noexcept;
+
+    AsyncChannel& channel_;
+    std::optional<T> value_;
+};
+
+
+inline bool AsyncOperationQueue::empty() const noexcept {
+    return head_ == nullptr;
+}
+
+inline void AsyncOperationQueue::push(AsyncOperation& operation) noexcept {
+    operation.next = nullptr;
+    if (tail_ == nullptr) {
+        head_ = &operation;
+    } else {
+        tail_->next = &operation;
+    }
+    tail_ = &operation;
+}
+
+inline AsyncOperation& AsyncOperationQueue::pop() noexcept {
+    AsyncOperation& operation = *head_;
+    head_ = operation.next;
+    if (head_ == nullptr) {
+        tail_ = nullptr;
+    }
+    return operation;
+}
+
+inline AsyncOperation* AsyncOperationQueue::release() noexcept {
+    AsyncOperation* operations = head_;
+    head_ = nullptr;
+    tail_ = nullptr;
+    return operations;
+}
+
+inline AsyncTask::AsyncTask(std::coroutine_handle<promise_type> handle) noexcept
+        : handle_(handle) {
+}
+
+inline AsyncTask::AsyncTask(AsyncTask&& other) noexcept
+        : handle_(std::exchange(other.handle_, nullptr)) {
+}
+
+inline AsyncTask& AsyncTask::operator=(AsyncTask&& other) noexcept {
+    if (this != &other) {
+        if (handle_) {
+            handle_.destroy();
+        }
+        handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+}
+
+inline AsyncTask::~AsyncTask() {
+    if (handle_) {
+        handle_.destroy();
+    }
+}
+
+inline AsyncOperation& AsyncTask::release() noexcept {
+    const auto handle = std::exchange(handle_, nullptr);
+    handle.promise().operation.handle = handle;
+    return handle.promise().operation;
+}
+
+inline void EventLoop::schedule(AsyncOperation& operation) noexcept {
+    ready_.push(operation);
+}
+
+inline void EventLoop::spawn(AsyncTask task) noexcept {
+    schedule(task.release());
+}
+
+inline std::size_t EventLoop::run() {
+    std::size_t resumed = 0;
+    while (!ready_.empty()) {
+        ready_.pop().handle.resume();
+        ++resumed;
+    }
+    return resumed;
+}
+
+inline bool EventLoop::idle() const noexcept {
+    return ready_.empty();
+}
+
+template<typename T, AsyncExecutor Executor>
+AsyncChannel<T, Executor>::AsyncChannel(size_type capacity, Executor& executor)
+        : buffer_(capacity)
+        , executor_(executor)
+        , closed_(false) {
+}
+
+template<typename T, AsyncExecutor Executor>
+bool AsyncChannel<T, Executor>::deliver(T& value, std::unique_lock<std::mutex>& lock) {
+    if (!poppers_.empty()) {
+        auto& popper = static_cast<PopAwaiter&>(poppers_.pop());
+        popper.value_.emplace(std::move(value));
+        lock.unlock();
+        executor_.schedule(popper);
+        return true;
+    }
+    return buffer_.push(std::move(value));
+}
+
+template<typename T, AsyncExecutor Executor>
+bool AsyncChannel<T, Executor>::receive(std::optional<T>& value, std::unique_lock<std::mutex>& lock) {
+    if (buffer_.empty()) {
+        return false;
+    }
+    value.emplace(std::move(buffer_.front()));
+    buffer_.pop();
+    if (!pushers_.empty()) {
+        auto& pusher = static_cast<PushAwaiter&>(pushers_.pop());
+        buffer_.push(std::move(pusher.value_));
+        pusher.accepted_ = true;
+        lock.unlock();
+        executor_.schedule(pusher);
+    }
+    return true;
+}
+
+template<typename T, AsyncExecutor Executor>
+void AsyncChannel<T, Executor>::schedule_all(AsyncOperation* operation) noexcept {
+    while (operation != nullptr) {
+        AsyncOperation* next = operation->next;
+        executor_.schedule(*operation);
+        operation = next;
+    }
+}
+
+template<typename T, AsyncExecutor Executor>
+typename AsyncChannel<T, Executor>::PushAwaiter AsyncChannel<T, Executor>::push(T value) {
+    return PushAwaiter(*this, std::move(value));
+}
+
+template<typename T, AsyncExecutor Executor>
+typename AsyncChannel<T, Executor>::PopAwaiter AsyncChannel<T, Executor>::pop() {
+    return PopAwaiter(*this);
+}
+
+template<typename T, AsyncExecutor Executor>
+bool AsyncChannel<T, Executor>::try_push(T& value) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    return !closed_ && deliver(value, lock);
+}
+
+template<typename T, AsyncExecutor Executor>
+std::optional<T> AsyncChannel<T, Executor>::try_pop() {
+    std::optional<T> value;
+    std::unique_lock<std::mutex> lock(mutex_);
+    receive(value, lock);
+    return value;
+}
+
+template<typename T, AsyncExecutor Executor>
+void AsyncChannel<T, Executor>::close() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    closed_ = true;
+    AsyncOperation* pushers = pushers_.release();
+    AsyncOperation* poppers = poppers_.release();
+    lock.unlock();
+    schedule_all(pushers);
+    schedule_all(poppers);
+}
+
+template<typename T, AsyncExecutor Executor>
+bool AsyncChannel<T, Executor>::closed() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return closed_;
+}
+
+template<typename T, AsyncExecutor Executor>
+typename AsyncChannel<T, Executor>::size_type AsyncChannel<T, Executor>::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return buffer_.size();
+}
+
+template<typename T, AsyncExecutor Executor>
+typename AsyncChannel<T, Executor>::size_type AsyncChannel<T, Executor>::capacity() const noexcept {
+    return buffer_.capacity();
+}
+
+template<typename T, AsyncExecutor Executor>
+AsyncChannel<T, Executor>::PushAwaiter::PushAwaiter(AsyncChannel& channel, T value)
+        : channel_(channel)
+        , value_(std::move(value))
+        , accepted_(false) {
+}
+
+template<typename T, AsyncExecutor Executor>
+bool AsyncChannel<T, Executor>::PushAwaiter::await_suspend(std::coroutine_handle<> handle) {
+    this->handle = handle;
+    std::unique_lock<std::mutex> lock(channel_.mutex_);
+    if (channel_.closed_) {
+        return false;
+    }
+    if (channel_.deliver(value_, lock)) {
+        accepted_ = true;
+        return false;
+    }
+    channel_.pushers_.push(*this);
+    return true;
+}
+
+template<typename T, AsyncExecutor Executor>
+AsyncChannel<T, Executor>::PopAwaiter::PopAwaiter(AsyncChannel& channel) noexcept
+        : channel_(channel) {
+}
+
+template<typename T, AsyncExecutor Executor>
+bool AsyncChannel<T, Executor>::PopAwaiter::await_suspend(std::coroutine_handle<> handle) {
+    this->handle = handle;
+    std::unique_lock<std::mutex> lock(channel_.mutex_);
+    if (channel_.receive(value_, lock) || channel_.closed_) {
+        return false;
+    }
+    channel_.poppers_.push(*this);
+    return true;
+}
+
+#endif
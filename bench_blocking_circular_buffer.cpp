@@ -0,0 +1,119 @@
+#include "blocking_circular_buffer.hpp"
+#include "circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t queue_capacity = 256;
+constexpr int items_per_producer = 1 << 14;
+
+using clock_type = std::chrono::steady_clock;
+
+std::int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now().time_since_epoch()).count();
+}
+
+class CondvarQueue {
+public:
+    explicit CondvarQueue(std::size_t capacity) : buffer_(capacity), closed_(false) {}
+
+    bool push_wait(std::int64_t value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_full_.wait(lock, [this] { return closed_ || !buffer_.full(); });
+        if (closed_) {
+            return false;
+        }
+        buffer_.push(value);
+        lock.unlock();
+        not_empty_.notify_one();
+        return true;
+    }
+
+    bool pop_wait(std::int64_t& value) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        not_empty_.wait(lock, [this] { return closed_ || !buffer_.empty(); });
+        if (buffer_.empty()) {
+            return false;
+        }
+        value = buffer_.front();
+        buffer_.pop();
+        lock.unlock();
+        not_full_.notify_one();
+        return true;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        not_empty_.notify_all();
+        not_full_.notify_all();
+    }
+
+private:
+    CircularBuffer<std::int64_t, ModuloCapacity, std::allocator<std::int64_t>, RejectNewest> buffer_;
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+    bool closed_;
+};
+
+double percentile(const std::vector<std::int64_t>& sorted, double fraction) {
+    return static_cast<double>(sorted[static_cast<std::size_t>(fraction * static_cast<double>(sorted.size() - 1))]);
+}
+
+template<typename Queue>
+void BM_BlockingLatency(benchmark::State& state) {
+    const auto pairs = static_cast<int>(state.range(0));
+    std::vector<std::int64_t> latencies;
+    for (auto _ : state) {
+        Queue queue(queue_capacity);
+        std::vector<std::vector<std::int64_t>> samples(static_cast<std::size_t>(pairs));
+        std::vector<std::thread> threads;
+        for (int p = 0; p < pairs; ++p) {
+            threads.emplace_back([&queue] {
+                for (int i = 0; i < items_per_producer; ++i) {
+                    queue.push_wait(now_ns());
+                }
+            });
+        }
+        for (auto& consumer_samples : samples) {
+            threads.emplace_back([&queue, &consumer_samples] {
+                consumer_samples.reserve(items_per_producer);
+                std::int64_t stamp = 0;
+                while (queue.pop_wait(stamp)) {
+                    consumer_samples.push_back(now_ns() - stamp);
+                }
+            });
+        }
+        for (int p = 0; p < pairs; ++p) {
+            threads[static_cast<std::size_t>(p)].join();
+        }
+        queue.close();
+        for (std::size_t c = 0; c < samples.size(); ++c) {
+            threads[static_cast<std::size_t>(pairs) + c].join();
+            latencies.insert(latencies.end(), samples[c].begin(), samples[c].end());
+        }
+    }
+
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p50_ns"] = percentile(latencies, 0.50);
+    state.counters["p99_ns"] = percentile(latencies, 0.99);
+    state.counters["p999_ns"] = percentile(latencies, 0.999);
+    state.SetItemsProcessed(state.iterations() * pairs * items_per_producer);
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_BlockingLatency, BlockingCircularBuffer<std::int64_t>)
+        ->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_BlockingLatency, CondvarQueue)
+        ->Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime();
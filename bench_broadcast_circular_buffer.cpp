@@ -0,0 +1,67 @@
+#include "broadcast_circular_buffer.hpp"
+#include "circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+struct Event {
+    std::uint64_t sequence;
+    double values[7];
+};
+
+constexpr std::size_t ring_capacity = 4096;
+constexpr std::size_t batch = 256;
+
+void BM_BroadcastFanOut(benchmark::State& state) {
+    const auto reader_count = static_cast<std::size_t>(state.range(0));
+    BroadcastCircularBuffer<Event> ring(ring_capacity, reader_count);
+    std::vector<BroadcastCircularBuffer<Event>::Reader> readers;
+    for (std::size_t i = 0; i < reader_count; ++i) {
+        readers.push_back(ring.subscribe());
+    }
+    Event event{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < batch; ++i) {
+            event.sequence = i;
+            ring.publish(event);
+        }
+        for (auto& reader : readers) {
+            Event received;
+            while (reader.try_read(received)) {
+                benchmark::DoNotOptimize(received);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(batch));
+}
+
+void BM_CopyPerReaderFanOut(benchmark::State& state) {
+    const auto reader_count = static_cast<std::size_t>(state.range(0));
+    std::vector<CircularBuffer<Event>> copies;
+    for (std::size_t i = 0; i < reader_count; ++i) {
+        copies.emplace_back(ring_capacity);
+    }
+    Event event{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < batch; ++i) {
+            event.sequence = i;
+            for (auto& copy : copies) {
+                copy.push(event);
+            }
+        }
+        for (auto& copy : copies) {
+            while (!copy.empty()) {
+                benchmark::DoNotOptimize(copy.front());
+                copy.pop();
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(batch));
+}
+
+}
+
+BENCHMARK(BM_BroadcastFanOut)->Arg(1)->Arg(3)->Arg(8);
+BENCHMARK(BM_CopyPerReaderFanOut)->Arg(1)->Arg(3)->Arg(8);
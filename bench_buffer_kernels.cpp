@@ -0,0 +1,159 @@
+#include "buffer_kernels.hpp"
+#include "circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdint>
+
+namespace {
+
+template<typename T>
+CircularBuffer<T> make_wrapped_buffer(std::size_t capacity, std::size_t shift = 3) {
+    CircularBuffer<T> buffer(capacity);
+    for (std::size_t i = 0; i < capacity + capacity / shift; ++i) {
+        buffer.push(static_cast<T>(i % 251));
+    }
+    return buffer;
+}
+
+void select(benchmark::State& state) {
+    if (BufferKernels::select_isa(static_cast<SimdIsa>(state.range(1))) != static_cast<SimdIsa>(state.range(1))) {
+        state.SkipWithError("instruction set not supported");
+    }
+}
+
+template<typename T>
+void BM_SumIterator(benchmark::State& state) {
+    const auto buffer = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        T total{};
+        for (T value : buffer) {
+            total += value;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void BM_SumKernel(benchmark::State& state) {
+    const auto buffer = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    select(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BufferKernels::sum(buffer));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void BM_MinMaxIterator(benchmark::State& state) {
+    const auto buffer = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        const auto [low, high] = std::minmax_element(buffer.begin(), buffer.end());
+        benchmark::DoNotOptimize(*low);
+        benchmark::DoNotOptimize(*high);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void BM_MinMaxKernel(benchmark::State& state) {
+    const auto buffer = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    select(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BufferKernels::minmax(buffer));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void BM_CountIterator(benchmark::State& state) {
+    const auto buffer = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::count_if(buffer.begin(), buffer.end(), [](T value) { return value > T(100); }));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void BM_CountKernel(benchmark::State& state) {
+    const auto buffer = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    select(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BufferKernels::count_if(buffer, T(100)));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void BM_DotIterator(benchmark::State& state) {
+    const auto x = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    const auto y = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)), 5);
+    for (auto _ : state) {
+        T total{};
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            total += x[i] * y[i];
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void BM_DotKernel(benchmark::State& state) {
+    const auto x = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    const auto y = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)), 5);
+    select(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BufferKernels::dot(x, y));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void BM_AxpyIterator(benchmark::State& state) {
+    const auto x = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    auto y = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)), 5);
+    for (auto _ : state) {
+        auto target = y.begin();
+        for (T value : x) {
+            *target = T(0.5) * value + *target;
+            ++target;
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename T>
+void BM_AxpyKernel(benchmark::State& state) {
+    const auto x = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)));
+    auto y = make_wrapped_buffer<T>(static_cast<std::size_t>(state.range(0)), 5);
+    select(state);
+    for (auto _ : state) {
+        BufferKernels::axpy(T(0.5), x, y);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void kernel_arguments(benchmark::internal::Benchmark* benchmark) {
+    for (int isa : {static_cast<int>(SimdIsa::scalar), static_cast<int>(SimdIsa::avx2),
+                    static_cast<int>(SimdIsa::avx512)}) {
+        benchmark->Args({1 << 16, isa});
+    }
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_SumIterator, float)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_SumKernel, float)->Apply(kernel_arguments);
+BENCHMARK_TEMPLATE(BM_SumIterator, std::int32_t)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_SumKernel, std::int32_t)->Apply(kernel_arguments);
+BENCHMARK_TEMPLATE(BM_MinMaxIterator, float)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_MinMaxKernel, float)->Apply(kernel_arguments);
+BENCHMARK_TEMPLATE(BM_CountIterator, std::int16_t)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_CountKernel, std::int16_t)->Apply(kernel_arguments);
+BENCHMARK_TEMPLATE(BM_DotIterator, double)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_DotKernel, double)->Apply(kernel_arguments);
+BENCHMARK_TEMPLATE(BM_AxpyIterator, float)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_AxpyKernel, float)->Apply(kernel_arguments);
@@ -0,0 +1,304 @@
+#include "circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstdio>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+namespace {
+
+struct StreamedDouble {
+    double value;
+};
+
+std::ostream& operator<<(std::ostream& out, const StreamedDouble& item) {
+    return out << item.value;
+}
+
+std::istream& operator>>(std::istream& in, StreamedDouble& item) {
+    return in >> item.value;
+}
+
+template<typename Buffer>
+void BM_PushPop(benchmark::State& state) {
+    Buffer buffer(static_cast<std::size_t>(state.range(0)));
+    const auto half = buffer.capacity() / 2;
+    for (std::size_t i = 0; i < half; ++i) {
+        buffer.push(static_cast<int>(i));
+    }
+    int value = 0;
+    for (auto _ : state) {
+        buffer.push(value);
+        value = buffer.front();
+        buffer.pop();
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Buffer>
+void BM_PushOverwrite(benchmark::State& state) {
+    Buffer buffer(static_cast<std::size_t>(state.range(0)));
+    int value = 0;
+    for (auto _ : state) {
+        buffer.push(++value);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Buffer>
+void BM_IndexedScan(benchmark::State& state) {
+    Buffer buffer(static_cast<std::size_t>(state.range(0)));
+    for (std::size_t i = 0; i < buffer.capacity() + buffer.capacity() / 3; ++i) {
+        buffer.push(static_cast<int>(i));
+    }
+    for (auto _ : state) {
+        long long sum = 0;
+        for (std::size_t i = 0; i < buffer.size(); ++i) {
+            sum += buffer[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(buffer.size()));
+}
+
+template<typename Buffer>
+void BM_IteratorScan(benchmark::State& state) {
+    Buffer buffer(static_cast<std::size_t>(state.range(0)));
+    for (std::size_t i = 0; i < buffer.capacity() + buffer.capacity() / 3; ++i) {
+        buffer.push(static_cast<int>(i));
+    }
+    for (auto _ : state) {
+        long long sum = 0;
+        for (int value : buffer) {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(buffer.size()));
+}
+
+using ModuloBuffer = CircularBuffer<int>;
+using PowerOfTwoBuffer = CircularBuffer<int, PowerOfTwoCapacity>;
+
+constexpr std::size_t batch_size = 256;
+
+void BM_BatchPushLoop(benchmark::State& state) {
+    CircularBuffer<int> buffer(static_cast<std::size_t>(state.range(0)));
+    std::vector<int> batch(batch_size, 7);
+    for (auto _ : state) {
+        for (int value : batch) {
+            buffer.push(value);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(batch_size));
+}
+
+void BM_BatchPushRange(benchmark::State& state) {
+    CircularBuffer<int> buffer(static_cast<std::size_t>(state.range(0)));
+    std::vector<int> batch(batch_size, 7);
+    for (auto _ : state) {
+        buffer.write(batch.data(), batch.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(batch_size));
+}
+
+void BM_BatchDrainLoop(benchmark::State& state) {
+    CircularBuffer<int> buffer(static_cast<std::size_t>(state.range(0)));
+    std::vector<int> batch(batch_size, 7);
+    for (auto _ : state) {
+        buffer.write(batch.data(), batch.size());
+        for (std::size_t i = 0; i < batch_size; ++i) {
+            batch[i] = buffer.front();
+            buffer.pop();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(batch_size));
+}
+
+void BM_BatchDrainRead(benchmark::State& state) {
+    CircularBuffer<int> buffer(static_cast<std::size_t>(state.range(0)));
+    std::vector<int> batch(batch_size, 7);
+    for (auto _ : state) {
+        buffer.write(batch.data(), batch.size());
+        buffer.read(batch.data(), batch.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(batch_size));
+}
+
+
+template<typename OverflowPolicy>
+void BM_PushOverflow(benchmark::State& state) {
+    using Buffer = CircularBuffer<int, ModuloCapacity, std::allocator<int>, OverflowPolicy>;
+    Buffer buffer(static_cast<std::size_t>(state.range(0)));
+    int value = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(buffer.push(++value));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_PushGrow(benchmark::State& state) {
+    for (auto _ : state) {
+        CircularBuffer<int, ModuloCapacity, std::allocator<int>, GrowCapacity> buffer(16);
+        for (int i = 0; i < state.range(0); ++i) {
+            buffer.push(i);
+        }
+        benchmark::DoNotOptimize(buffer.array_one().first);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+CircularBuffer<int> make_filled_buffer(std::size_t capacity) {
+    CircularBuffer<int> buffer(capacity);
+    for (std::size_t i = 0; i < capacity + capacity / 3; ++i) {
+        buffer.push(static_cast<int>(i));
+    }
+    return buffer;
+}
+
+void BM_SaveToFile(benchmark::State& state) {
+    const auto buffer = make_filled_buffer(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        buffer.saveToFile("bench_legacy.bin");
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<long long>(sizeof(int)));
+    std::remove("bench_legacy.bin");
+}
+
+void BM_LoadFromFile(benchmark::State& state) {
+    make_filled_buffer(static_cast<std::size_t>(state.range(0))).saveToFile("bench_legacy.bin");
+    CircularBuffer<int> buffer(1);
+    for (auto _ : state) {
+        buffer.loadFromFile("bench_legacy.bin");
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<long long>(sizeof(int)));
+    std::remove("bench_legacy.bin");
+}
+
+void BM_SaveSnapshot(benchmark::State& state) {
+    const auto buffer = make_filled_buffer(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        buffer.saveSnapshot("bench_snapshot.bin");
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<long long>(sizeof(int)));
+    std::remove("bench_snapshot.bin");
+}
+
+void BM_LoadSnapshot(benchmark::State& state) {
+    make_filled_buffer(static_cast<std::size_t>(state.range(0))).saveSnapshot("bench_snapshot.bin");
+    CircularBuffer<int> buffer(1);
+    for (auto _ : state) {
+        buffer.loadSnapshot("bench_snapshot.bin");
+    }
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<long long>(sizeof(int)));
+    std::remove("bench_snapshot.bin");
+}
+
+CircularBuffer<int> make_buffer_with(std::size_t capacity, std::size_t count) {
+    CircularBuffer<int> buffer(capacity);
+    for (std::size_t i = 0; i < capacity / 2 + count; ++i) {
+        buffer.push(static_cast<int>(i));
+    }
+    buffer.pop_n(buffer.size() - std::min(buffer.size(), count));
+    return buffer;
+}
+
+void BM_CopyConstruct(benchmark::State& state) {
+    const auto source = make_buffer_with(1 << 20, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        CircularBuffer<int> copy(source);
+        benchmark::DoNotOptimize(copy.array_one().first);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_CopyAssign(benchmark::State& state) {
+    const auto source = make_buffer_with(1 << 20, static_cast<std::size_t>(state.range(0)));
+    CircularBuffer<int> target(1 << 20);
+    for (auto _ : state) {
+        target = source;
+        benchmark::DoNotOptimize(target.array_one().first);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_ResizeShrinkGrow(benchmark::State& state) {
+    auto buffer = make_buffer_with(1 << 20, static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        buffer.resize(1 << 19);
+        buffer.resize(1 << 20);
+        benchmark::DoNotOptimize(buffer.array_one().first);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template<typename Element>
+CircularBuffer<Element> make_filled_text_buffer(std::size_t capacity) {
+    CircularBuffer<Element> buffer(capacity);
+    for (std::size_t i = 0; i < capacity; ++i) {
+        buffer.push(Element{static_cast<double>(i) * 0.001});
+    }
+    return buffer;
+}
+
+template<typename Element>
+void BM_SaveToTextFile(benchmark::State& state) {
+    const auto buffer = make_filled_text_buffer<Element>(static_cast<std::size_t>(state.range(0)));
+    for (auto _ : state) {
+        buffer.saveToTextFile("bench_text.txt");
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove("bench_text.txt");
+}
+
+template<typename Element>
+void BM_LoadFromTextFile(benchmark::State& state) {
+    make_filled_text_buffer<Element>(static_cast<std::size_t>(state.range(0))).saveToTextFile("bench_text.txt");
+    CircularBuffer<Element> buffer(1);
+    for (auto _ : state) {
+        buffer.loadFromTextFile("bench_text.txt");
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    std::remove("bench_text.txt");
+}
+}
+
+BENCHMARK_TEMPLATE(BM_PushPop, ModuloBuffer)->Arg(1000)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_PushPop, PowerOfTwoBuffer)->Arg(1000)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_PushOverwrite, ModuloBuffer)->Arg(1000)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_PushOverwrite, PowerOfTwoBuffer)->Arg(1000)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_IndexedScan, ModuloBuffer)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_IndexedScan, PowerOfTwoBuffer)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_IteratorScan, ModuloBuffer)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_IteratorScan, PowerOfTwoBuffer)->Arg(1 << 16);
+
+BENCHMARK_TEMPLATE(BM_PushOverflow, OverwriteOldest)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_PushOverflow, RejectNewest)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_PushOverflow, DropNewest)->Arg(1024);
+BENCHMARK(BM_PushGrow)->Arg(1 << 16);
+
+BENCHMARK(BM_BatchPushLoop)->Arg(1000)->Arg(1 << 16);
+BENCHMARK(BM_BatchPushRange)->Arg(1000)->Arg(1 << 16);
+BENCHMARK(BM_BatchDrainLoop)->Arg(1000)->Arg(1 << 16);
+BENCHMARK(BM_BatchDrainRead)->Arg(1000)->Arg(1 << 16);
+
+BENCHMARK(BM_CopyConstruct)->Arg(10)->Arg(1 << 20);
+BENCHMARK(BM_CopyAssign)->Arg(10)->Arg(1 << 20);
+BENCHMARK(BM_ResizeShrinkGrow)->Arg(10)->Arg(1 << 19);
+
+BENCHMARK(BM_SaveToFile)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadFromFile)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_SaveSnapshot)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_LoadSnapshot)->Arg(10'000'000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_SaveToTextFile, StreamedDouble)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_SaveToTextFile, double)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_LoadFromTextFile, StreamedDouble)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_LoadFromTextFile, double)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
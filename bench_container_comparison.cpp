@@ -0,0 +1,211 @@
+#include "circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+template<typename T>
+class DequeRing {
+public:
+    explicit DequeRing(std::size_t capacity) : capacity_(capacity) {}
+
+    void push(const T& value) {
+        if (items_.size() == capacity_) {
+            items_.pop_front();
+        }
+        items_.push_back(value);
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        if (items_.size() == capacity_) {
+            items_.pop_front();
+        }
+        items_.emplace_back(std::forward<Args>(args)...);
+    }
+
+    void pop() { items_.pop_front(); }
+    T& front() { return items_.front(); }
+    T& operator[](std::size_t index) { return items_[index]; }
+    std::size_t size() const noexcept { return items_.size(); }
+    std::size_t capacity() const noexcept { return capacity_; }
+    auto begin() { return items_.begin(); }
+    auto end() { return items_.end(); }
+
+private:
+    std::size_t capacity_;
+    std::deque<T> items_;
+};
+
+template<typename T>
+class VectorRing {
+public:
+    explicit VectorRing(std::size_t capacity) : items_(capacity) {}
+
+    void push(const T& value) {
+        items_[(head_ + size_) % items_.size()] = value;
+        advance();
+    }
+
+    template<typename... Args>
+    void emplace(Args&&... args) {
+        items_[(head_ + size_) % items_.size()] = T(std::forward<Args>(args)...);
+        advance();
+    }
+
+    void pop() {
+        head_ = (head_ + 1) % items_.size();
+        --size_;
+    }
+
+    T& front() { return items_[head_]; }
+    T& operator[](std::size_t index) { return items_[(head_ + index) % items_.size()]; }
+    std::size_t size() const noexcept { return size_; }
+    std::size_t capacity() const noexcept { return items_.size(); }
+
+    template<typename Function>
+    void for_each(Function function) {
+        for (std::size_t i = 0; i < size_; ++i) {
+            function((*this)[i]);
+        }
+    }
+
+private:
+    std::vector<T> items_;
+    std::size_t head_ = 0;
+    std::size_t size_ = 0;
+
+    void advance() {
+        if (size_ == items_.size()) {
+            head_ = (head_ + 1) % items_.size();
+        } else {
+            ++size_;
+        }
+    }
+};
+
+template<typename T>
+T make_value(std::size_t index) {
+    if constexpr (std::is_same_v<T, std::string>) {
+        return std::string(24, static_cast<char>('a' + index % 26));
+    } else {
+        return static_cast<T>(index);
+    }
+}
+
+template<typename Ring>
+void fill(Ring& ring) {
+    using T = std::decay_t<decltype(ring.front())>;
+    for (std::size_t i = 0; i < ring.capacity() + ring.capacity() / 3; ++i) {
+        ring.push(make_value<T>(i));
+    }
+}
+
+template<typename Ring, typename Function>
+void visit(Ring& ring, Function function) {
+    if constexpr (requires { ring.for_each(function); }) {
+        ring.for_each(function);
+    } else {
+        for (auto& value : ring) {
+            function(value);
+        }
+    }
+}
+
+template<template<typename> class Ring, typename T>
+void BM_SteadyPushPop(benchmark::State& state) {
+    Ring<T> ring(static_cast<std::size_t>(state.range(0)));
+    fill(ring);
+    ring.pop();
+    const T value = make_value<T>(7);
+    for (auto _ : state) {
+        ring.push(value);
+        benchmark::DoNotOptimize(ring.front());
+        ring.pop();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<template<typename> class Ring, typename T>
+void BM_Emplace(benchmark::State& state) {
+    Ring<T> ring(static_cast<std::size_t>(state.range(0)));
+    std::size_t index = 0;
+    for (auto _ : state) {
+        if constexpr (std::is_same_v<T, std::string>) {
+            ring.emplace(24, static_cast<char>('a' + index++ % 26));
+        } else {
+            ring.emplace(static_cast<T>(index++));
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<template<typename> class Ring, typename T>
+void BM_Iterate(benchmark::State& state) {
+    Ring<T> ring(static_cast<std::size_t>(state.range(0)));
+    fill(ring);
+    for (auto _ : state) {
+        std::size_t checksum = 0;
+        visit(ring, [&checksum](const T& value) {
+            if constexpr (std::is_same_v<T, std::string>) {
+                checksum += value.size();
+            } else {
+                checksum += static_cast<std::size_t>(value);
+            }
+        });
+        benchmark::DoNotOptimize(checksum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(ring.size()));
+}
+
+template<template<typename> class Ring, typename T>
+void BM_RandomAccess(benchmark::State& state) {
+    Ring<T> ring(static_cast<std::size_t>(state.range(0)));
+    fill(ring);
+    std::size_t index = 0;
+    for (auto _ : state) {
+        index = (index * 1103515245 + 12345) % ring.size();
+        benchmark::DoNotOptimize(ring[index]);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename T>
+using Circular = CircularBuffer<T>;
+
+void capacities(benchmark::internal::Benchmark* benchmark) {
+    benchmark->Arg(64)->Arg(4096)->Arg(1 << 16);
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_SteadyPushPop, Circular, int)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_SteadyPushPop, DequeRing, int)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_SteadyPushPop, VectorRing, int)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_SteadyPushPop, Circular, std::string)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_SteadyPushPop, DequeRing, std::string)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_SteadyPushPop, VectorRing, std::string)->Apply(capacities);
+
+BENCHMARK_TEMPLATE(BM_Emplace, Circular, double)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Emplace, DequeRing, double)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Emplace, VectorRing, double)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Emplace, Circular, std::string)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Emplace, DequeRing, std::string)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Emplace, VectorRing, std::string)->Apply(capacities);
+
+BENCHMARK_TEMPLATE(BM_Iterate, Circular, double)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Iterate, DequeRing, double)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Iterate, VectorRing, double)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Iterate, Circular, std::string)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Iterate, DequeRing, std::string)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_Iterate, VectorRing, std::string)->Apply(capacities);
+
+BENCHMARK_TEMPLATE(BM_RandomAccess, Circular, int)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_RandomAccess, DequeRing, int)->Apply(capacities);
+BENCHMARK_TEMPLATE(BM_RandomAccess, VectorRing, int)->Apply(capacities);
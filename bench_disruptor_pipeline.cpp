@@ -0,0 +1,166 @@
+#include "disruptor_pipeline.hpp"
+#include "circular_buffer.hpp"
+#include "spsc_circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+namespace {
+
+struct Message {
+    char raw[32];
+    std::uint64_t id;
+    double price;
+    double enriched;
+    std::uint64_t checksum;
+};
+
+constexpr std::size_t ring_capacity = 1024;
+constexpr std::size_t batch = 256;
+constexpr std::size_t threaded_messages = 1 << 16;
+
+void fill(Message& message, std::uint64_t id) {
+    std::memset(message.raw, 0, sizeof(message.raw));
+    std::memcpy(message.raw, &id, sizeof(id));
+}
+
+void parse(Message& message) {
+    std::memcpy(&message.id, message.raw, sizeof(message.id));
+    message.price = static_cast<double>(message.id) * 0.25;
+}
+
+void enrich(Message& message) {
+    message.enriched = message.price * 1.0001 + 3.0;
+}
+
+void finish(Message& message) {
+    message.checksum = message.id ^ static_cast<std::uint64_t>(message.enriched);
+}
+
+void BM_PipelineInPlace(benchmark::State& state) {
+    DisruptorPipeline<Message, 3, BusySpinWait> pipeline(ring_capacity);
+    std::uint64_t checksum = 0;
+    for (auto _ : state) {
+        pipeline.publish_batch(batch, [](Message& message, std::size_t i) { fill(message, i); });
+        pipeline.try_process(0, parse);
+        pipeline.try_process(1, enrich);
+        pipeline.try_process(2, [&checksum](Message& message) {
+            finish(message);
+            checksum += message.checksum;
+        });
+    }
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(batch));
+}
+
+void BM_CopyingStages(benchmark::State& state) {
+    CircularBuffer<Message> raw(ring_capacity);
+    CircularBuffer<Message> parsed(ring_capacity);
+    CircularBuffer<Message> enriched(ring_capacity);
+    std::uint64_t checksum = 0;
+    Message message{};
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < batch; ++i) {
+            fill(message, i);
+            raw.push(message);
+        }
+        while (!raw.empty()) {
+            message = raw.front();
+            raw.pop();
+            parse(message);
+            parsed.push(message);
+        }
+        while (!parsed.empty()) {
+            message = parsed.front();
+            parsed.pop();
+            enrich(message);
+            enriched.push(message);
+        }
+        while (!enriched.empty()) {
+            message = enriched.front();
+            enriched.pop();
+            finish(message);
+            checksum += message.checksum;
+        }
+    }
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(batch));
+}
+
+template<typename WaitStrategy>
+void BM_ThreadedPipeline(benchmark::State& state) {
+    std::uint64_t checksum = 0;
+    for (auto _ : state) {
+        DisruptorPipeline<Message, 3, WaitStrategy> pipeline(ring_capacity);
+        std::thread first([&pipeline] { pipeline.run(0, parse); });
+        std::thread second([&pipeline] { pipeline.run(1, enrich); });
+        std::thread third([&pipeline, &checksum] {
+            pipeline.run(2, [&checksum](Message& message) {
+                finish(message);
+                checksum += message.checksum;
+            });
+        });
+        for (std::size_t sent = 0; sent < threaded_messages;) {
+            sent += pipeline.publish_batch(batch, [sent](Message& message, std::size_t i) { fill(message, sent + i); });
+        }
+        pipeline.close();
+        first.join();
+        second.join();
+        third.join();
+    }
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(threaded_messages));
+}
+
+void forward(SpscCircularBuffer<Message>& from, SpscCircularBuffer<Message>* to, void (*stage)(Message&),
+             std::uint64_t& checksum) {
+    Message message;
+    for (std::size_t received = 0; received < threaded_messages;) {
+        if (!from.try_pop(message)) {
+            std::this_thread::yield();
+            continue;
+        }
+        ++received;
+        stage(message);
+        if (to == nullptr) {
+            checksum += message.checksum;
+            continue;
+        }
+        while (!to->try_push(message)) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+void BM_ThreadedCopyingStages(benchmark::State& state) {
+    std::uint64_t checksum = 0;
+    for (auto _ : state) {
+        SpscCircularBuffer<Message> raw(ring_capacity);
+        SpscCircularBuffer<Message> parsed(ring_capacity);
+        SpscCircularBuffer<Message> enriched(ring_capacity);
+        std::thread first([&] { forward(raw, &parsed, parse, checksum); });
+        std::thread second([&] { forward(parsed, &enriched, enrich, checksum); });
+        std::thread third([&] { forward(enriched, nullptr, finish, checksum); });
+        Message message{};
+        for (std::size_t sent = 0; sent < threaded_messages; ++sent) {
+            fill(message, sent);
+            while (!raw.try_push(message)) {
+                std::this_thread::yield();
+            }
+        }
+        first.join();
+        second.join();
+        third.join();
+    }
+    benchmark::DoNotOptimize(checksum);
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(threaded_messages));
+}
+
+}
+
+BENCHMARK(BM_PipelineInPlace);
+BENCHMARK(BM_CopyingStages);
+BENCHMARK_TEMPLATE(BM_ThreadedPipeline, YieldingWait)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ThreadedPipeline, BlockingWait)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_ThreadedCopyingStages)->Unit(benchmark::kMillisecond)->UseRealTime();
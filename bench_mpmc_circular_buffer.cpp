@@ -0,0 +1,90 @@
+#include "circular_buffer.hpp"
+#include "mpmc_circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+constexpr std::size_t queue_capacity = 1024;
+constexpr int items_per_thread = 1 << 16;
+
+MpmcCircularBuffer<int> mpmc_queue(queue_capacity);
+
+std::mutex locked_mutex;
+CircularBuffer<int> locked_queue(queue_capacity);
+
+bool locked_try_push(int value) {
+    std::lock_guard<std::mutex> lock(locked_mutex);
+    if (locked_queue.full()) {
+        return false;
+    }
+    locked_queue.push(value);
+    return true;
+}
+
+bool locked_try_pop(int& value) {
+    std::lock_guard<std::mutex> lock(locked_mutex);
+    if (locked_queue.empty()) {
+        return false;
+    }
+    value = locked_queue.front();
+    locked_queue.pop();
+    return true;
+}
+
+template<typename Push, typename Pop>
+void run_producer_or_consumer(benchmark::State& state, Push push, Pop pop) {
+    const bool producer = state.thread_index() % 2 == 0;
+    for (auto _ : state) {
+        int value = 0;
+        for (int i = 0; i < items_per_thread; ++i) {
+            if (producer) {
+                while (!push(i)) {
+                    std::this_thread::yield();
+                }
+            } else {
+                while (!pop(value)) {
+                    std::this_thread::yield();
+                }
+                benchmark::DoNotOptimize(value);
+            }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * items_per_thread);
+}
+
+void BM_MpmcProducerConsumer(benchmark::State& state) {
+    run_producer_or_consumer(state,
+                             [](int value) { return mpmc_queue.try_push(value); },
+                             [](int& value) { return mpmc_queue.try_pop(value); });
+}
+
+void BM_LockedCircularBufferProducerConsumer(benchmark::State& state) {
+    run_producer_or_consumer(state, locked_try_push, locked_try_pop);
+}
+
+void BM_MpmcBatchProducerConsumer(benchmark::State& state) {
+    constexpr std::size_t batch = 32;
+    const bool producer = state.thread_index() % 2 == 0;
+    int values[batch] = {};
+    for (auto _ : state) {
+        for (int done = 0; done < items_per_thread;) {
+            const std::size_t wanted = std::min<std::size_t>(batch, items_per_thread - done);
+            const std::size_t moved = producer ? mpmc_queue.try_push_batch(values, wanted)
+                                               : mpmc_queue.try_pop_batch(values, wanted);
+            if (moved == 0) {
+                std::this_thread::yield();
+            }
+            done += static_cast<int>(moved);
+        }
+        benchmark::DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * items_per_thread);
+}
+
+}
+
+BENCHMARK(BM_MpmcProducerConsumer)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(BM_MpmcBatchProducerConsumer)->ThreadRange(2, 16)->UseRealTime();
+BENCHMARK(BM_LockedCircularBufferProducerConsumer)->ThreadRange(2, 16)->UseRealTime();
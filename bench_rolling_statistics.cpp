@@ -0,0 +1,67 @@
+#include "rolling_statistics.hpp"
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace {
+
+std::vector<double> make_samples(std::size_t count) {
+    std::mt19937 generator(7);
+    std::uniform_real_distribution<double> distribution(0.0, 100.0);
+    std::vector<double> samples(count);
+    for (double& sample : samples) {
+        sample = distribution(generator);
+    }
+    return samples;
+}
+
+void BM_RollingRecompute(benchmark::State& state) {
+    const auto window = static_cast<std::size_t>(state.range(0));
+    const auto samples = make_samples(4096);
+    CircularBuffer<double> buffer(window);
+    std::size_t next = 0;
+    for (auto _ : state) {
+        buffer.push(samples[next++ & 4095]);
+        double sum = 0.0;
+        double low = buffer.front();
+        double high = buffer.front();
+        for (double value : buffer) {
+            sum += value;
+            low = std::min(low, value);
+            high = std::max(high, value);
+        }
+        const double mean = sum / static_cast<double>(buffer.size());
+        double squares = 0.0;
+        for (double value : buffer) {
+            squares += (value - mean) * (value - mean);
+        }
+        benchmark::DoNotOptimize(mean);
+        benchmark::DoNotOptimize(squares);
+        benchmark::DoNotOptimize(low);
+        benchmark::DoNotOptimize(high);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_RollingIncremental(benchmark::State& state) {
+    const auto window = static_cast<std::size_t>(state.range(0));
+    const auto samples = make_samples(4096);
+    RollingStatistics<double> stats(window);
+    const auto& moments = stats.get<RollingMoments<double>>();
+    const auto& extremes = stats.get<RollingMinMax<double>>();
+    std::size_t next = 0;
+    for (auto _ : state) {
+        stats.push(samples[next++ & 4095]);
+        benchmark::DoNotOptimize(moments.mean());
+        benchmark::DoNotOptimize(moments.variance());
+        benchmark::DoNotOptimize(extremes.min());
+        benchmark::DoNotOptimize(extremes.max());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_RollingRecompute)->Arg(64)->Arg(4096);
+BENCHMARK(BM_RollingIncremental)->Arg(64)->Arg(4096);
@@ -0,0 +1,62 @@
+#include "circular_buffer.hpp"
+#include "sharded_circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t shard_capacity = 4096;
+constexpr int items_per_thread = 1 << 14;
+
+ShardedCircularBuffer<std::uint64_t> thread_shards(shard_capacity, 16);
+ShardedCircularBuffer<std::uint64_t> cpu_shards(shard_capacity, 16, ShardSelection::cpu);
+
+std::mutex shared_mutex;
+CircularBuffer<std::uint64_t> shared_buffer(shard_capacity * 16);
+
+void BM_SharedLockPush(benchmark::State& state) {
+    for (auto _ : state) {
+        for (int i = 0; i < items_per_thread; ++i) {
+            std::lock_guard<std::mutex> lock(shared_mutex);
+            shared_buffer.push(static_cast<std::uint64_t>(i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * items_per_thread);
+}
+
+template<ShardedCircularBuffer<std::uint64_t>& Buffer>
+void BM_ShardedPush(benchmark::State& state) {
+    for (auto _ : state) {
+        for (int i = 0; i < items_per_thread; ++i) {
+            Buffer.push(static_cast<std::uint64_t>(i));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * items_per_thread);
+}
+
+void BM_ShardedOrderedDrain(benchmark::State& state) {
+    ShardedCircularBuffer<std::uint64_t> buffer(shard_capacity, 8);
+    std::vector<std::uint64_t> drained;
+    drained.reserve(shard_capacity * 8);
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (std::uint64_t i = 0; i < shard_capacity; ++i) {
+            buffer.push(i);
+        }
+        drained.clear();
+        state.ResumeTiming();
+        buffer.drain_ordered(std::back_inserter(drained));
+        benchmark::DoNotOptimize(drained.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(shard_capacity));
+}
+
+}
+
+BENCHMARK(BM_SharedLockPush)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ShardedPush, thread_shards)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_ShardedPush, cpu_shards)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK(BM_ShardedOrderedDrain);
@@ -0,0 +1,99 @@
+#include "soa_circular_buffer.hpp"
+#include "buffer_kernels.hpp"
+#include "circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+struct Record {
+    std::int64_t timestamp;
+    double price;
+    double quantity;
+    std::uint32_t flags;
+};
+
+using Records = SoACircularBuffer<std::int64_t, double, double, std::uint32_t>;
+
+template<typename Buffer>
+void fill(Buffer& buffer, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto value = static_cast<double>(i % 97);
+        if constexpr (std::is_same_v<Buffer, Records>) {
+            buffer.push(static_cast<std::int64_t>(i), value, value * 2, static_cast<std::uint32_t>(i));
+        } else {
+            buffer.push(Record{static_cast<std::int64_t>(i), value, value * 2, static_cast<std::uint32_t>(i)});
+        }
+    }
+}
+
+void BM_AoSPriceSum(benchmark::State& state) {
+    const auto capacity = static_cast<std::size_t>(state.range(0));
+    CircularBuffer<Record> buffer(capacity);
+    fill(buffer, capacity + capacity / 3);
+    for (auto _ : state) {
+        double sum = 0;
+        for (const Record& record : buffer) {
+            sum += record.price;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SoAPriceSum(benchmark::State& state) {
+    const auto capacity = static_cast<std::size_t>(state.range(0));
+    Records buffer(capacity);
+    fill(buffer, capacity + capacity / 3);
+    for (auto _ : state) {
+        double sum = 0;
+        const auto [first, second] = buffer.column<1>().segments();
+        for (double price : first) {
+            sum += price;
+        }
+        for (double price : second) {
+            sum += price;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_SoAPriceSumKernel(benchmark::State& state) {
+    const auto capacity = static_cast<std::size_t>(state.range(0));
+    Records buffer(capacity);
+    fill(buffer, capacity + capacity / 3);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(BufferKernels::sum(buffer.column<1>()));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_AoSPush(benchmark::State& state) {
+    CircularBuffer<Record> buffer(4096);
+    std::int64_t i = 0;
+    for (auto _ : state) {
+        buffer.push(Record{i, 1.0, 2.0, 3});
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+void BM_SoAPush(benchmark::State& state) {
+    Records buffer(4096);
+    std::int64_t i = 0;
+    for (auto _ : state) {
+        buffer.push(i, 1.0, 2.0, 3u);
+        ++i;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+}
+
+BENCHMARK(BM_AoSPriceSum)->Arg(4096)->Arg(1 << 20);
+BENCHMARK(BM_SoAPriceSum)->Arg(4096)->Arg(1 << 20);
+BENCHMARK(BM_SoAPriceSumKernel)->Arg(4096)->Arg(1 << 20);
+BENCHMARK(BM_AoSPush);
+BENCHMARK(BM_SoAPush);
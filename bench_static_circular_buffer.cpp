@@ -0,0 +1,92 @@
+#include "static_circular_buffer.hpp"
+#include "circular_buffer.hpp"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+
+namespace {
+
+template<std::size_t N>
+void BM_StaticPushPop(benchmark::State& state) {
+    StaticCircularBuffer<int, N> buffer;
+    for (std::size_t i = 0; i < N / 2; ++i) {
+        buffer.push(static_cast<int>(i));
+    }
+    int value = 0;
+    for (auto _ : state) {
+        buffer.push(value++);
+        benchmark::DoNotOptimize(buffer.front());
+        buffer.pop();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<std::size_t N>
+void BM_DynamicPushPop(benchmark::State& state) {
+    CircularBuffer<int> buffer(N);
+    for (std::size_t i = 0; i < N / 2; ++i) {
+        buffer.push(static_cast<int>(i));
+    }
+    int value = 0;
+    for (auto _ : state) {
+        buffer.push(value++);
+        benchmark::DoNotOptimize(buffer.front());
+        buffer.pop();
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Buffer>
+void fill_and_scan(benchmark::State& state, Buffer& buffer) {
+    for (std::size_t i = 0; i < buffer.capacity() + buffer.capacity() / 3; ++i) {
+        buffer.push(static_cast<int>(i));
+    }
+    for (auto _ : state) {
+        long long sum = 0;
+        for (std::size_t i = 0; i < buffer.size(); ++i) {
+            sum += buffer[i];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<long long>(buffer.size()));
+}
+
+template<std::size_t N>
+void BM_StaticIndexedScan(benchmark::State& state) {
+    StaticCircularBuffer<int, N> buffer;
+    fill_and_scan(state, buffer);
+}
+
+template<std::size_t N>
+void BM_DynamicIndexedScan(benchmark::State& state) {
+    CircularBuffer<int> buffer(N);
+    fill_and_scan(state, buffer);
+}
+
+void BM_StaticConstruct(benchmark::State& state) {
+    for (auto _ : state) {
+        StaticCircularBuffer<int, 64> buffer;
+        buffer.push(1);
+        benchmark::DoNotOptimize(buffer.front());
+    }
+}
+
+void BM_DynamicConstruct(benchmark::State& state) {
+    for (auto _ : state) {
+        CircularBuffer<int> buffer(64);
+        buffer.push(1);
+        benchmark::DoNotOptimize(buffer.front());
+    }
+}
+
+}
+
+BENCHMARK_TEMPLATE(BM_StaticPushPop, 64);
+BENCHMARK_TEMPLATE(BM_DynamicPushPop, 64);
+BENCHMARK_TEMPLATE(BM_StaticPushPop, 1000);
+BENCHMARK_TEMPLATE(BM_DynamicPushPop, 1000);
+BENCHMARK_TEMPLATE(BM_StaticIndexedScan, 64);
+BENCHMARK_TEMPLATE(BM_DynamicIndexedScan, 64);
+BENCHMARK_TEMPLATE(BM_StaticIndexedScan, 4096);
+BENCHMARK_TEMPLATE(BM_DynamicIndexedScan, 4096);
+BENCHMARK(BM_StaticConstruct);
+BENCHMARK(BM_DynamicConstruct);
@@ -0,0 +1,289 @@
+#ifndef BLOCKING_CIRCULAR_BUFFER_HPP
+#define BLOCKING_CIRCULAR_BUFFER_HPP
+
+#include "mpmc_circular_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <utility>
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+template<typename T>
+class BlockingCircularBuffer {
+public:
+    using value_type = T;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+
+    explicit BlockingCircularBuffer(size_type capacity);
+
+    BlockingCircularBuffer(const BlockingCircularBuffer&) = delete;
+    BlockingCircularBuffer& operator=(const BlockingCircularBuffer&) = delete;
+
+    [[nodiscard]] bool try_push(const_reference value);
+    [[nodiscard]] bool try_push(T&& value);
+    [[nodiscard]] bool try_pop(T& value);
+
+    bool push_wait(const_reference value);
+    bool push_wait(T&& value);
+    bool pop_wait(T& value);
+
+    template<typename Rep, typename Period>
+    [[nodiscard]] bool try_push_for(const_reference value, const std::chrono::duration<Rep, Period>& timeout);
+    template<typename Rep, typename Period>
+    [[nodiscard]] bool try_push_for(T&& value, const std::chrono::duration<Rep, Period>& timeout);
+    template<typename Rep, typename Period>
+    [[nodiscard]] bool try_pop_for(T& value, const std::chrono::duration<Rep, Period>& timeout);
+
+    template<typename InputIt>
+    size_type try_push_batch(InputIt first, size_type count);
+    template<typename OutputIt>
+    size_type try_pop_batch(OutputIt out, size_type max_count);
+
+    void close() noexcept;
+    [[nodiscard]] bool closed() const noexcept;
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    static constexpr size_type cache_line_size = 64;
+    static constexpr std::uint32_t min_spin = 16;
+    static constexpr std::uint32_t max_spin = 256;
+
+    struct alignas(cache_line_size) WaitQueue {
+        std::atomic<std::uint32_t> epoch{0};
+        std::atomic<std::uint32_t> waiters{0};
+    };
+
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t),
+                  "futex words must be plain 32-bit integers");
+
+    MpmcCircularBuffer<T> ring_;
+    WaitQueue not_empty_;
+    WaitQueue not_full_;
+    std::atomic<std::uint32_t> spin_limit_;
+    std::atomic<bool> closed_;
+
+    template<typename Operation>
+    bool wait_until(WaitQueue& queue, Operation operation, const clock::time_point* deadline);
+    void notify(WaitQueue& queue, size_type count) noexcept;
+
+    static void cpu_relax() noexcept;
+    static bool futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected,
+                           const clock::time_point* deadline) noexcept;
+    static size_type futex_wake(std::atomic<std::uint32_t>& word, size_type count) noexcept;
+};
+
+
+template<typename T>
+BlockingCircularBuffer<T>::BlockingCircularBuffer(size_type capacity)
+        : ring_(capacity)
+        , spin_limit_(min_spin)
+        , closed_(false) {
+}
+
+template<typename T>
+void BlockingCircularBuffer<T>::cpu_relax() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#endif
+}
+
+template<typename T>
+bool BlockingCircularBuffer<T>::futex_wait(std::atomic<std::uint32_t>& word, std::uint32_t expected,
+                                           const clock::time_point* deadline) noexcept {
+    timespec timeout{};
+    if (deadline != nullptr) {
+        const auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(*deadline - clock::now());
+        if (remaining.count() <= 0) {
+            return false;
+        }
+        timeout.tv_sec = static_cast<std::time_t>(remaining.count() / 1000000000);
+        timeout.tv_nsec = static_cast<long>(remaining.count() % 1000000000);
+    }
+    return ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected,
+                     deadline != nullptr ? &timeout : nullptr, nullptr, 0) == 0;
+}
+
+template<typename T>
+typename BlockingCircularBuffer<T>::size_type
+BlockingCircularBuffer<T>::futex_wake(std::atomic<std::uint32_t>& word, size_type count) noexcept {
+    const long woken = ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE_PRIVATE,
+                                 static_cast<int>(std::min<size_type>(count, INT_MAX)), nullptr, nullptr, 0);
+    return woken > 0 ? static_cast<size_type>(woken) : 0;
+}
+
+template<typename T>
+void BlockingCircularBuffer<T>::notify(WaitQueue& queue, size_type count) noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const std::uint32_t waiters = queue.waiters.load(std::memory_order_relaxed);
+    if (count == 0 || waiters == 0) {
+        return;
+    }
+    queue.epoch.fetch_add(1, std::memory_order_release);
+    if (const size_type woken = futex_wake(queue.epoch, std::min<size_type>(count, waiters)); woken != 0) {
+        queue.waiters.fetch_sub(static_cast<std::uint32_t>(woken), std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+template<typename Operation>
+bool BlockingCircularBuffer<T>::wait_until(WaitQueue& queue, Operation operation, const clock::time_point* deadline) {
+    const std::uint32_t limit = spin_limit_.load(std::memory_order_relaxed);
+    for (std::uint32_t spin = 0; spin < limit; ++spin) {
+        if (operation()) {
+            spin_limit_.store(std::min(max_spin, limit + (limit >> 3) + 1), std::memory_order_relaxed);
+            return true;
+        }
+        if (closed_.load(std::memory_order_acquire)) {
+            return operation();
+        }
+        cpu_relax();
+    }
+    spin_limit_.store(std::max(min_spin, limit - (limit >> 3)), std::memory_order_relaxed);
+
+    for (;;) {
+        const std::uint32_t epoch = queue.epoch.load(std::memory_order_acquire);
+        queue.waiters.fetch_add(1, std::memory_order_seq_cst);
+        const bool done = operation();
+        if (done || closed_.load(std::memory_order_acquire) ||
+            (deadline != nullptr && clock::now() >= *deadline)) {
+            queue.waiters.fetch_sub(1, std::memory_order_relaxed);
+            return done || operation();
+        }
+        if (!futex_wait(queue.epoch, epoch, deadline)) {
+            queue.waiters.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename T>
+bool BlockingCircularBuffer<T>::try_push(const_reference value) {
+    if (closed_.load(std::memory_order_acquire) || !ring_.try_push(value)) {
+        return false;
+    }
+    notify(not_empty_, 1);
+    return true;
+}
+
+template<typename T>
+bool BlockingCircularBuffer<T>::try_push(T&& value) {
+    if (closed_.load(std::memory_order_acquire) || !ring_.try_push(std::move(value))) {
+        return false;
+    }
+    notify(not_empty_, 1);
+    return true;
+}
+
+template<typename T>
+bool BlockingCircularBuffer<T>::try_pop(T& value) {
+    if (!ring_.try_pop(value)) {
+        return false;
+    }
+    notify(not_full_, 1);
+    return true;
+}
+
+template<typename T>
+bool BlockingCircularBuffer<T>::push_wait(const_reference value) {
+    return wait_until(not_full_, [this, &value] { return try_push(value); }, nullptr);
+}
+
+template<typename T>
+bool BlockingCircularBuffer<T>::push_wait(T&& value) {
+    return wait_until(not_full_, [this, &value] { return try_push(std::move(value)); }, nullptr);
+}
+
+template<typename T>
+bool BlockingCircularBuffer<T>::pop_wait(T& value) {
+    return wait_until(not_empty_, [this, &value] { return try_pop(value); }, nullptr);
+}
+
+template<typename T>
+template<typename Rep, typename Period>
+bool BlockingCircularBuffer<T>::try_push_for(const_reference value,
+                                             const std::chrono::duration<Rep, Period>& timeout) {
+    const auto deadline = clock::now() + std::chrono::duration_cast<clock::duration>(timeout);
+    return wait_until(not_full_, [this, &value] { return try_push(value); }, &deadline);
+}
+
+template<typename T>
+template<typename Rep, typename Period>
+bool BlockingCircularBuffer<T>::try_push_for(T&& value, const std::chrono::duration<Rep, Period>& timeout) {
+    const auto deadline = clock::now() + std::chrono::duration_cast<clock::duration>(timeout);
+    return wait_until(not_full_, [this, &value] { return try_push(std::move(value)); }, &deadline);
+}
+
+template<typename T>
+template<typename Rep, typename Period>
+bool BlockingCircularBuffer<T>::try_pop_for(T& value, const std::chrono::duration<Rep, Period>& timeout) {
+    const auto deadline = clock::now() + std::chrono::duration_cast<clock::duration>(timeout);
+    return wait_until(not_empty_, [this, &value] { return try_pop(value); }, &deadline);
+}
+
+template<typename T>
+template<typename InputIt>
+typename BlockingCircularBuffer<T>::size_type
+BlockingCircularBuffer<T>::try_push_batch(InputIt first, size_type count) {
+    if (closed_.load(std::memory_order_acquire)) {
+        return 0;
+    }
+    const size_type pushed = ring_.try_push_batch(first, count);
+    notify(not_empty_, pushed);
+    return pushed;
+}
+
+template<typename T>
+template<typename OutputIt>
+typename BlockingCircularBuffer<T>::size_type
+BlockingCircularBuffer<T>::try_pop_batch(OutputIt out, size_type max_count) {
+    const size_type popped = ring_.try_pop_batch(out, max_count);
+    notify(not_full_, popped);
+    return popped;
+}
+
+template<typename T>
+void BlockingCircularBuffer<T>::close() noexcept {
+    closed_.store(true, std::memory_order_seq_cst);
+    for (WaitQueue* queue : {&not_empty_, &not_full_}) {
+        queue->epoch.fetch_add(1, std::memory_order_release);
+        queue->waiters.fetch_sub(static_cast<std::uint32_t>(futex_wake(queue->epoch, INT_MAX)),
+                                 std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+bool BlockingCircularBuffer<T>::closed() const noexcept {
+    return closed_.load(std::memory_order_acquire);
+}
+
+template<typename T>
+bool BlockingCircularBuffer<T>::empty() const noexcept {
+    return ring_.empty();
+}
+
+template<typename T>
+typename BlockingCircularBuffer<T>::size_type BlockingCircularBuffer<T>::size() const noexcept {
+    return ring_.size();
+}
+
+template<typename T>
+typename BlockingCircularBuffer<T>::size_type BlockingCircularBuffer<T>::capacity() const noexcept {
+    return ring_.capacity();
+}
+
+#endif
@@ -0,0 +1,319 @@
+#ifndef BROADCAST_CIRCULAR_BUFFER_HPP
+#define BROADCAST_CIRCULAR_BUFFER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+template<typename T>
+class BroadcastCircularBuffer {
+    static_assert(std::is_trivially_copyable_v<T>, "BroadcastCircularBuffer requires a trivially copyable type");
+
+public:
+    using value_type = T;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+
+    struct ReaderLag {
+        size_type reader;
+        std::uint64_t position;
+        std::uint64_t lag;
+        std::uint64_t lost;
+    };
+
+    class Reader;
+
+    explicit BroadcastCircularBuffer(size_type capacity, size_type max_readers = 16);
+
+    BroadcastCircularBuffer(const BroadcastCircularBuffer&) = delete;
+    BroadcastCircularBuffer& operator=(const BroadcastCircularBuffer&) = delete;
+
+    void publish(const_reference value) noexcept;
+    template<typename InputIt>
+    size_type publish_range(InputIt first, InputIt last) noexcept;
+
+    [[nodiscard]] Reader subscribe();
+
+    [[nodiscard]] std::uint64_t published() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] size_type max_readers() const noexcept;
+    [[nodiscard]] size_type reader_count() const noexcept;
+    [[nodiscard]] std::vector<ReaderLag> lag_report(std::uint64_t min_lag = 0) const;
+
+private:
+    static constexpr size_type cache_line_size = 64;
+
+    struct Slot {
+        std::atomic<std::uint64_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    struct alignas(cache_line_size) ReaderState {
+        std::atomic<bool> active;
+        std::atomic<std::uint64_t> cursor;
+        std::atomic<std::uint64_t> lost;
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    std::unique_ptr<ReaderState[]> readers_;
+    size_type capacity_;
+    size_type max_readers_;
+
+    alignas(cache_line_size) std::atomic<std::uint64_t> head_;
+
+    Slot& slot(std::uint64_t position) const noexcept;
+    void write(std::uint64_t position, const_reference value) noexcept;
+};
+
+
+template<typename T>
+class BroadcastCircularBuffer<T>::Reader {
+public:
+    Reader(Reader&& other) noexcept;
+    Reader& operator=(Reader&& other) noexcept;
+    ~Reader();
+
+    [[nodiscard]] bool try_read(T& value) noexcept;
+    template<typename OutputIt>
+    size_type read_batch(OutputIt out, size_type max_count) noexcept;
+
+    [[nodiscard]] size_type id() const noexcept;
+    [[nodiscard]] std::uint64_t position() const noexcept;
+    [[nodiscard]] std::uint64_t lag() const noexcept;
+    [[nodiscard]] std::uint64_t lost() const noexcept;
+
+private:
+    friend class BroadcastCircularBuffer;
+
+    Reader(BroadcastCircularBuffer* owner, size_type id) noexcept;
+    void release() noexcept;
+
+    BroadcastCircularBuffer* owner_;
+    size_type id_;
+    std::uint64_t cursor_;
+};
+
+template<typename T>
+BroadcastCircularBuffer<T>::BroadcastCircularBuffer(size_type capacity, size_type max_readers)
+        : capacity_(capacity)
+        , max_readers_(max_readers)
+        , head_(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Capacity must be greater than 0");
+    }
+    if (max_readers == 0) {
+        throw std::invalid_argument("Reader count must be greater than 0");
+    }
+    slots_ = std::make_unique<Slot[]>(capacity);
+    for (size_type i = 0; i < capacity; ++i) {
+        slots_[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    readers_ = std::make_unique<ReaderState[]>(max_readers);
+    for (size_type i = 0; i < max_readers; ++i) {
+        readers_[i].active.store(false, std::memory_order_relaxed);
+        readers_[i].cursor.store(0, std::memory_order_relaxed);
+        readers_[i].lost.store(0, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+typename BroadcastCircularBuffer<T>::Slot& BroadcastCircularBuffer<T>::slot(std::uint64_t position) const noexcept {
+    return slots_[static_cast<size_type>(position % capacity_)];
+}
+
+template<typename T>
+void BroadcastCircularBuffer<T>::write(std::uint64_t position, const_reference value) noexcept {
+    Slot& target = slot(position);
+    target.sequence.store(2 * position + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(target.storage, &value, sizeof(T));
+    target.sequence.store(2 * position + 2, std::memory_order_release);
+}
+
+template<typename T>
+void BroadcastCircularBuffer<T>::publish(const_reference value) noexcept {
+    const std::uint64_t head = head_.load(std::memory_order_relaxed);
+    write(head, value);
+    head_.store(head + 1, std::memory_order_release);
+}
+
+template<typename T>
+template<typename InputIt>
+typename BroadcastCircularBuffer<T>::size_type
+BroadcastCircularBuffer<T>::publish_range(InputIt first, InputIt last) noexcept {
+    const std::uint64_t head = head_.load(std::memory_order_relaxed);
+    std::uint64_t position = head;
+    for (; first != last; ++first, ++position) {
+        write(position, *first);
+    }
+    head_.store(position, std::memory_order_release);
+    return static_cast<size_type>(position - head);
+}
+
+template<typename T>
+typename BroadcastCircularBuffer<T>::Reader BroadcastCircularBuffer<T>::subscribe() {
+    for (size_type i = 0; i < max_readers_; ++i) {
+        bool expected = false;
+        if (!readers_[i].active.load(std::memory_order_relaxed) &&
+            readers_[i].active.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+            return Reader(this, i);
+        }
+    }
+    throw std::runtime_error("Too many readers");
+}
+
+template<typename T>
+std::uint64_t BroadcastCircularBuffer<T>::published() const noexcept {
+    return head_.load(std::memory_order_acquire);
+}
+
+template<typename T>
+typename BroadcastCircularBuffer<T>::size_type BroadcastCircularBuffer<T>::capacity() const noexcept {
+    return capacity_;
+}
+
+template<typename T>
+typename BroadcastCircularBuffer<T>::size_type BroadcastCircularBuffer<T>::max_readers() const noexcept {
+    return max_readers_;
+}
+
+template<typename T>
+typename BroadcastCircularBuffer<T>::size_type BroadcastCircularBuffer<T>::reader_count() const noexcept {
+    size_type count = 0;
+    for (size_type i = 0; i < max_readers_; ++i) {
+        count += readers_[i].active.load(std::memory_order_relaxed) ? 1 : 0;
+    }
+    return count;
+}
+
+template<typename T>
+std::vector<typename BroadcastCircularBuffer<T>::ReaderLag>
+BroadcastCircularBuffer<T>::lag_report(std::uint64_t min_lag) const {
+    const std::uint64_t head = head_.load(std::memory_order_acquire);
+    std::vector<ReaderLag> report;
+    for (size_type i = 0; i < max_readers_; ++i) {
+        if (!readers_[i].active.load(std::memory_order_acquire)) {
+            continue;
+        }
+        const std::uint64_t cursor = readers_[i].cursor.load(std::memory_order_relaxed);
+        const std::uint64_t lag = head - std::min(cursor, head);
+        if (lag >= min_lag) {
+            report.push_back(ReaderLag{i, cursor, lag, readers_[i].lost.load(std::memory_order_relaxed)});
+        }
+    }
+    std::sort(report.begin(), report.end(), [](const ReaderLag& lhs, const ReaderLag& rhs) {
+        return lhs.lag > rhs.lag;
+    });
+    return report;
+}
+
+template<typename T>
+BroadcastCircularBuffer<T>::Reader::Reader(BroadcastCircularBuffer* owner, size_type id) noexcept
+        : owner_(owner)
+        , id_(id)
+        , cursor_(owner->head_.load(std::memory_order_acquire)) {
+    owner_->readers_[id_].lost.store(0, std::memory_order_relaxed);
+    owner_->readers_[id_].cursor.store(cursor_, std::memory_order_relaxed);
+}
+
+template<typename T>
+BroadcastCircularBuffer<T>::Reader::Reader(Reader&& other) noexcept
+        : owner_(std::exchange(other.owner_, nullptr))
+        , id_(other.id_)
+        , cursor_(other.cursor_) {
+}
+
+template<typename T>
+typename BroadcastCircularBuffer<T>::Reader& BroadcastCircularBuffer<T>::Reader::operator=(Reader&& other) noexcept {
+    if (this != &other) {
+        release();
+        owner_ = std::exchange(other.owner_, nullptr);
+        id_ = other.id_;
+        cursor_ = other.cursor_;
+    }
+    return *this;
+}
+
+template<typename T>
+BroadcastCircularBuffer<T>::Reader::~Reader() {
+    release();
+}
+
+template<typename T>
+void BroadcastCircularBuffer<T>::Reader::release() noexcept {
+    if (owner_ != nullptr) {
+        owner_->readers_[id_].active.store(false, std::memory_order_release);
+        owner_ = nullptr;
+    }
+}
+
+template<typename T>
+bool BroadcastCircularBuffer<T>::Reader::try_read(T& value) noexcept {
+    ReaderState& state = owner_->readers_[id_];
+    for (;;) {
+        const Slot& source = owner_->slot(cursor_);
+        const std::uint64_t expected = 2 * cursor_ + 2;
+        const std::uint64_t before = source.sequence.load(std::memory_order_acquire);
+        if (before == expected) {
+            std::memcpy(&value, source.storage, sizeof(T));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (source.sequence.load(std::memory_order_relaxed) == expected) {
+                ++cursor_;
+                state.cursor.store(cursor_, std::memory_order_relaxed);
+                return true;
+            }
+        } else if (before < expected) {
+            return false;
+        }
+
+        const std::uint64_t head = owner_->head_.load(std::memory_order_acquire);
+        const std::uint64_t oldest = head > owner_->capacity_ ? head - owner_->capacity_ + 1 : 0;
+        const std::uint64_t resume = std::max(oldest, cursor_ + 1);
+        state.lost.store(state.lost.load(std::memory_order_relaxed) + (resume - cursor_), std::memory_order_relaxed);
+        cursor_ = resume;
+        state.cursor.store(cursor_, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+template<typename OutputIt>
+typename BroadcastCircularBuffer<T>::size_type
+BroadcastCircularBuffer<T>::Reader::read_batch(OutputIt out, size_type max_count) noexcept {
+    size_type count = 0;
+    T value;
+    while (count < max_count && try_read(value)) {
+        *out = value;
+        ++out;
+        ++count;
+    }
+    return count;
+}
+
+template<typename T>
+typename BroadcastCircularBuffer<T>::size_type BroadcastCircularBuffer<T>::Reader::id() const noexcept {
+    return id_;
+}
+
+template<typename T>
+std::uint64_t BroadcastCircularBuffer<T>::Reader::position() const noexcept {
+    return cursor_;
+}
+
+template<typename T>
+std::uint64_t BroadcastCircularBuffer<T>::Reader::lag() const noexcept {
+    return owner_->head_.load(std::memory_order_acquire) - cursor_;
+}
+
+template<typename T>
+std::uint64_t BroadcastCircularBuffer<T>::Reader::lost() const noexcept {
+    return owner_->readers_[id_].lost.load(std::memory_order_relaxed);
+}
+
+#endif
@@ -0,0 +1,406 @@
+#ifndef BUFFER_KERNELS_HPP
+#define BUFFER_KERNELS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+enum class SimdIsa {
+    scalar,
+    avx2,
+    avx512
+};
+
+class BufferKernels {
+    template<typename Buffer>
+    using element_type = std::remove_const_t<
+            std::remove_pointer_t<decltype(std::declval<Buffer&>().array_one().first)>>;
+
+public:
+    static SimdIsa supported_isa() noexcept;
+    static SimdIsa active_isa() noexcept;
+    static SimdIsa select_isa(SimdIsa isa) noexcept;
+
+    template<typename Buffer>
+    static element_type<Buffer> sum(const Buffer& buffer);
+    template<typename Buffer>
+    static std::pair<element_type<Buffer>, element_type<Buffer>> minmax(const Buffer& buffer);
+    template<typename Buffer, typename Compare = std::greater<>>
+    static std::size_t count_if(const Buffer& buffer, element_type<Buffer> threshold, Compare compare = Compare());
+    template<typename Buffer>
+    static element_type<Buffer> dot(const Buffer& x, const Buffer& y);
+    template<typename Buffer>
+    static void transform(Buffer& buffer, element_type<Buffer> scale, element_type<Buffer> offset);
+    template<typename Buffer>
+    static void axpy(element_type<Buffer> a, const Buffer& x, Buffer& y);
+
+private:
+    template<typename T, std::size_t Bytes>
+    struct Lanes {
+        typedef T vector __attribute__((vector_size(Bytes)));
+        typedef T unaligned __attribute__((vector_size(Bytes), aligned(alignof(T)), may_alias));
+        static constexpr std::size_t width = Bytes / sizeof(T);
+
+        [[gnu::always_inline]] inline static const unaligned& load(const T* data) noexcept {
+            return *reinterpret_cast<const unaligned*>(data);
+        }
+
+        [[gnu::always_inline]] inline static unaligned& at(T* data) noexcept {
+            return *reinterpret_cast<unaligned*>(data);
+        }
+    };
+
+    struct Sum {
+        template<std::size_t Bytes, typename T>
+        [[gnu::always_inline]] inline static T run(const T* data, std::size_t size) noexcept;
+    };
+
+    struct MinMax {
+        template<std::size_t Bytes, typename T>
+        [[gnu::always_inline]] inline static std::pair<T, T> run(const T* data, std::size_t size) noexcept;
+    };
+
+    struct Count {
+        template<typename Compare, typename T>
+        static constexpr bool vector_compare =
+                std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<T>> ||
+                std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>> ||
+                std::is_same_v<Compare, std::greater_equal<>> || std::is_same_v<Compare, std::greater_equal<T>> ||
+                std::is_same_v<Compare, std::less_equal<>> || std::is_same_v<Compare, std::less_equal<T>> ||
+                std::is_same_v<Compare, std::equal_to<>> || std::is_same_v<Compare, std::equal_to<T>> ||
+                std::is_same_v<Compare, std::not_equal_to<>> || std::is_same_v<Compare, std::not_equal_to<T>>;
+
+        template<std::size_t Bytes, typename T, typename Compare>
+        [[gnu::always_inline]] inline static std::size_t run(const T* data, std::size_t size, T threshold,
+                                                             Compare compare) noexcept;
+
+        template<typename Compare, typename Mask, typename Vector, typename T>
+        [[gnu::always_inline]] inline static void accumulate(Mask& hits, const Vector& value, T threshold) noexcept;
+    };
+
+    struct Dot {
+        template<std::size_t Bytes, typename T>
+        [[gnu::always_inline]] inline static T run(const T* x, const T* y, std::size_t size) noexcept;
+    };
+
+    struct Scale {
+        template<std::size_t Bytes, typename T>
+        [[gnu::always_inline]] inline static void run(T* data, std::size_t size, T scale, T offset) noexcept;
+    };
+
+    struct Axpy {
+        template<std::size_t Bytes, typename T>
+        [[gnu::always_inline]] inline static void run(T a, const T* x, T* y, std::size_t size) noexcept;
+    };
+
+    static std::atomic<SimdIsa>& isa() noexcept;
+
+    template<typename Kernel, typename T, typename... Args>
+    static auto dispatch(Args... args) noexcept;
+
+#if defined(__x86_64__) || defined(__i386__)
+    template<typename Kernel, typename T, typename... Args>
+    [[gnu::target("avx2,fma")]] static auto run_avx2(Args... args) noexcept;
+    template<typename Kernel, typename T, typename... Args>
+    [[gnu::target("avx512f,avx512bw,avx512dq,avx512vl")]] static auto run_avx512(Args... args) noexcept;
+#endif
+
+    template<typename First, typename Second, typename Function>
+    static void for_each_chunk(First& x, Second& y, Function function);
+};
+
+
+inline SimdIsa BufferKernels::supported_isa() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+        __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl")) {
+        return SimdIsa::avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) {
+        return SimdIsa::avx2;
+    }
+#endif
+    return SimdIsa::scalar;
+}
+
+inline std::atomic<SimdIsa>& BufferKernels::isa() noexcept {
+    static std::atomic<SimdIsa> selected{supported_isa()};
+    return selected;
+}
+
+inline SimdIsa BufferKernels::active_isa() noexcept {
+    return isa().load(std::memory_order_relaxed);
+}
+
+inline SimdIsa BufferKernels::select_isa(SimdIsa requested) noexcept {
+    const SimdIsa selected = std::min(requested, supported_isa());
+    isa().store(selected, std::memory_order_relaxed);
+    return selected;
+}
+
+template<std::size_t Bytes, typename T>
+inline T BufferKernels::Sum::run(const T* data, std::size_t size) noexcept {
+    T total{};
+    std::size_t i = 0;
+    if constexpr (Bytes != 0) {
+        using lanes = Lanes<T, Bytes>;
+        typename lanes::vector accumulator{};
+        for (; i + lanes::width <= size; i += lanes::width) {
+            accumulator += lanes::load(data + i);
+        }
+        for (std::size_t lane = 0; lane < lanes::width; ++lane) {
+            total += accumulator[lane];
+        }
+    }
+    for (; i < size; ++i) {
+        total += data[i];
+    }
+    return total;
+}
+
+template<std::size_t Bytes, typename T>
+inline std::pair<T, T> BufferKernels::MinMax::run(const T* data, std::size_t size) noexcept {
+    T low = data[0];
+    T high = data[0];
+    std::size_t i = 0;
+    if constexpr (Bytes != 0) {
+        using lanes = Lanes<T, Bytes>;
+        if (size >= lanes::width) {
+            typename lanes::vector lows = lanes::load(data);
+            typename lanes::vector highs = lows;
+            for (i = lanes::width; i + lanes::width <= size; i += lanes::width) {
+                const typename lanes::vector value = lanes::load(data + i);
+                lows = value < lows ? value : lows;
+                highs = highs < value ? value : highs;
+            }
+            for (std::size_t lane = 0; lane < lanes::width; ++lane) {
+                low = std::min<T>(low, lows[lane]);
+                high = std::max<T>(high, highs[lane]);
+            }
+        }
+    }
+    for (; i < size; ++i) {
+        low = std::min(low, data[i]);
+        high = std::max(high, data[i]);
+    }
+    return {low, high};
+}
+
+template<std::size_t Bytes, typename T, typename Compare>
+inline std::size_t
+BufferKernels::Count::run(const T* data, std::size_t size, T threshold, Compare compare) noexcept {
+    std::size_t count = 0;
+    std::size_t i = 0;
+    if constexpr (Bytes != 0 && vector_compare<Compare, T>) {
+        using lanes = Lanes<T, Bytes>;
+        using mask = decltype(std::declval<typename lanes::vector>() > threshold);
+        constexpr std::size_t block = 127 * lanes::width;
+        while (i + lanes::width <= size) {
+            mask hits{};
+            const std::size_t end = i + std::min(block, (size - i) / lanes::width * lanes::width);
+            for (; i < end; i += lanes::width) {
+                accumulate<Compare>(hits, lanes::load(data + i), threshold);
+            }
+            for (std::size_t lane = 0; lane < lanes::width; ++lane) {
+                count += static_cast<std::size_t>(hits[lane]);
+            }
+        }
+    }
+    for (; i < size; ++i) {
+        count += compare(data[i], threshold) ? 1 : 0;
+    }
+    return count;
+}
+
+template<typename Compare, typename Mask, typename Vector, typename T>
+inline void BufferKernels::Count::accumulate(Mask& hits, const Vector& value, T threshold) noexcept {
+    if constexpr (std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<T>>) {
+        hits -= value > threshold;
+    } else if constexpr (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>>) {
+        hits -= value < threshold;
+    } else if constexpr (std::is_same_v<Compare, std::greater_equal<>> ||
+                         std::is_same_v<Compare, std::greater_equal<T>>) {
+        hits -= value >= threshold;
+    } else if constexpr (std::is_same_v<Compare, std::less_equal<>> || std::is_same_v<Compare, std::less_equal<T>>) {
+        hits -= value <= threshold;
+    } else if constexpr (std::is_same_v<Compare, std::equal_to<>> || std::is_same_v<Compare, std::equal_to<T>>) {
+        hits -= value == threshold;
+    } else {
+        hits -= value != threshold;
+    }
+}
+
+template<std::size_t Bytes, typename T>
+inline T BufferKernels::Dot::run(const T* x, const T* y, std::size_t size) noexcept {
+    T total{};
+    std::size_t i = 0;
+    if constexpr (Bytes != 0) {
+        using lanes = Lanes<T, Bytes>;
+        typename lanes::vector accumulator{};
+        for (; i + lanes::width <= size; i += lanes::width) {
+            accumulator += lanes::load(x + i) * lanes::load(y + i);
+        }
+        for (std::size_t lane = 0; lane < lanes::width; ++lane) {
+            total += accumulator[lane];
+        }
+    }
+    for (; i < size; ++i) {
+        total += x[i] * y[i];
+    }
+    return total;
+}
+
+template<std::size_t Bytes, typename T>
+inline void BufferKernels::Scale::run(T* data, std::size_t size, T scale, T offset) noexcept {
+    std::size_t i = 0;
+    if constexpr (Bytes != 0) {
+        using lanes = Lanes<T, Bytes>;
+        for (; i + lanes::width <= size; i += lanes::width) {
+            lanes::at(data + i) = lanes::load(data + i) * scale + offset;
+        }
+    }
+    for (; i < size; ++i) {
+        data[i] = static_cast<T>(data[i] * scale + offset);
+    }
+}
+
+template<std::size_t Bytes, typename T>
+inline void BufferKernels::Axpy::run(T a, const T* x, T* y, std::size_t size) noexcept {
+    std::size_t i = 0;
+    if constexpr (Bytes != 0) {
+        using lanes = Lanes<T, Bytes>;
+        for (; i + lanes::width <= size; i += lanes::width) {
+            lanes::at(y + i) = lanes::load(x + i) * a + lanes::load(y + i);
+        }
+    }
+    for (; i < size; ++i) {
+        y[i] = static_cast<T>(a * x[i] + y[i]);
+    }
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+template<typename Kernel, typename T, typename... Args>
+auto BufferKernels::run_avx2(Args... args) noexcept {
+    return Kernel::template run<32, T>(args...);
+}
+
+template<typename Kernel, typename T, typename... Args>
+auto BufferKernels::run_avx512(Args... args) noexcept {
+    return Kernel::template run<64, T>(args...);
+}
+#endif
+
+template<typename Kernel, typename T, typename... Args>
+auto BufferKernels::dispatch(Args... args) noexcept {
+    static_assert(std::is_arithmetic_v<T> && !std::is_same_v<T, bool> && sizeof(T) <= 8 &&
+                  !std::is_same_v<T, long double>,
+                  "BufferKernels requires an arithmetic element type of at most 8 bytes");
+#if defined(__x86_64__) || defined(__i386__)
+    switch (active_isa()) {
+        case SimdIsa::avx512:
+            return run_avx512<Kernel, T>(args...);
+        case SimdIsa::avx2:
+            return run_avx2<Kernel, T>(args...);
+        case SimdIsa::scalar:
+            break;
+    }
+#endif
+    return Kernel::template run<0, T>(args...);
+}
+
+template<typename First, typename Second, typename Function>
+void BufferKernels::for_each_chunk(First& x, Second& y, Function function) {
+    if (x.size() != y.size()) {
+        throw std::invalid_argument("Buffers must have the same size");
+    }
+    const auto xs = {x.array_one(), x.array_two()};
+    const auto ys = {y.array_one(), y.array_two()};
+    auto x_segment = xs.begin();
+    auto y_segment = ys.begin();
+    std::size_t x_offset = 0;
+    std::size_t y_offset = 0;
+    for (std::size_t remaining = x.size(); remaining > 0;) {
+        const std::size_t count = std::min(x_segment->second - x_offset, y_segment->second - y_offset);
+        function(x_segment->first + x_offset, y_segment->first + y_offset, count);
+        remaining -= count;
+        x_offset += count;
+        y_offset += count;
+        if (x_offset == x_segment->second) {
+            ++x_segment;
+            x_offset = 0;
+        }
+        if (y_offset == y_segment->second) {
+            ++y_segment;
+            y_offset = 0;
+        }
+    }
+}
+
+template<typename Buffer>
+BufferKernels::element_type<Buffer> BufferKernels::sum(const Buffer& buffer) {
+    using T = element_type<Buffer>;
+    const auto [first, first_size] = buffer.array_one();
+    const auto [second, second_size] = buffer.array_two();
+    return static_cast<T>(dispatch<Sum, T>(first, first_size) + dispatch<Sum, T>(second, second_size));
+}
+
+template<typename Buffer>
+std::pair<BufferKernels::element_type<Buffer>, BufferKernels::element_type<Buffer>>
+BufferKernels::minmax(const Buffer& buffer) {
+    using T = element_type<Buffer>;
+    if (buffer.empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    const auto [first, first_size] = buffer.array_one();
+    const auto [second, second_size] = buffer.array_two();
+    auto result = dispatch<MinMax, T>(first, first_size);
+    if (second_size != 0) {
+        const auto [low, high] = dispatch<MinMax, T>(second, second_size);
+        result.first = std::min(result.first, low);
+        result.second = std::max(result.second, high);
+    }
+    return result;
+}
+
+template<typename Buffer, typename Compare>
+std::size_t BufferKernels::count_if(const Buffer& buffer, element_type<Buffer> threshold, Compare compare) {
+    using T = element_type<Buffer>;
+    const auto [first, first_size] = buffer.array_one();
+    const auto [second, second_size] = buffer.array_two();
+    return dispatch<Count, T>(first, first_size, threshold, compare) +
+           dispatch<Count, T>(second, second_size, threshold, compare);
+}
+
+template<typename Buffer>
+BufferKernels::element_type<Buffer> BufferKernels::dot(const Buffer& x, const Buffer& y) {
+    using T = element_type<Buffer>;
+    T total{};
+    for_each_chunk(x, y, [&total](const T* first, const T* second, std::size_t count) {
+        total += dispatch<Dot, T>(first, second, count);
+    });
+    return total;
+}
+
+template<typename Buffer>
+void BufferKernels::transform(Buffer& buffer, element_type<Buffer> scale, element_type<Buffer> offset) {
+    using T = element_type<Buffer>;
+    const auto [first, first_size] = buffer.array_one();
+    const auto [second, second_size] = buffer.array_two();
+    dispatch<Scale, T>(first, first_size, scale, offset);
+    dispatch<Scale, T>(second, second_size, scale, offset);
+}
+
+template<typename Buffer>
+void BufferKernels::axpy(element_type<Buffer> a, const Buffer& x, Buffer& y) {
+    using T = element_type<Buffer>;
+    for_each_chunk(x, y, [a](const T* source, T* target, std::size_t count) {
+        dispatch<Axpy, T>(a, source, target, count);
+    });
+}
+
+#endif
@@ -1,530 +1,1573 @@
-#ifndef CIRCULAR_BUFFER_HPP
-#define CIRCULAR_BUFFER_HPP
-
-#include <memory>
-#include <stdexcept>
-#include <utility>
-#include <algorithm>
-#include <fstream>
-#include <string>
-#include <cstdio>
-
-template<typename T>
-class CircularBuffer {
-public:
-    using reference = T&;
-    using const_reference = const T&;
-    using pointer = T*;
-    using size_type = std::size_t;
-
-    explicit CircularBuffer(size_type capacity);
-    CircularBuffer(size_type capacity, const_reference value);
-    CircularBuffer(std::initializer_list<T> init);
-
-    CircularBuffer(const CircularBuffer& other);
-    CircularBuffer(CircularBuffer&& other) noexcept;
-    CircularBuffer& operator=(const CircularBuffer& other);
-    CircularBuffer& operator=(CircularBuffer&& other) noexcept;
-    ~CircularBuffer();
-
-    reference front();
-    const_reference front() const;
-    reference back();
-    const_reference back() const;
-    reference operator[](size_type index);
-    const_reference operator[](size_type index) const;
-
-    [[nodiscard]] bool empty() const noexcept;
-    [[nodiscard]] bool full() const noexcept;
-    [[nodiscard]] size_type size() const noexcept;
-    [[nodiscard]] size_type capacity() const noexcept;
-
-    void push(const_reference value);
-    void push(T&& value);
-    template<typename... Args>
-    void emplace(Args&&... args);
-    void pop();
-    void clear() noexcept;
-    void resize(size_type new_capacity);
-
-    void saveToFile(const std::string& filename) const;
-    void loadFromFile(const std::string& filename);
-    void saveToTextFile(const std::string& filename) const;
-    void loadFromTextFile(const std::string& filename);
-
-    class iterator;
-    class const_iterator;
-
-    iterator begin() noexcept;
-    const_iterator begin() const noexcept;
-    const_iterator cbegin() const noexcept;
-    iterator end() noexcept;
-    const_iterator end() const noexcept;
-    const_iterator cend() const noexcept;
-
-private:
-    std::unique_ptr<T[]> buffer_;
-    size_type capacity_;
-    size_type head_;
-    size_type tail_;
-    size_type size_;
-
-    size_type next_index(size_type index) const noexcept;
-    void advance_head() noexcept;
-    void advance_tail() noexcept;
-};
-
-
-template<typename T>
-CircularBuffer<T>::CircularBuffer(size_type capacity)
-        : buffer_(std::make_unique<T[]>(capacity))
-        , capacity_(capacity)
-        , head_(0)
-        , tail_(0)
-        , size_(0) {
-    if (capacity == 0) {
-        throw std::invalid_argument("Capacity must be greater than 0");
-    }
-}
-
-template<typename T>
-CircularBuffer<T>::CircularBuffer(size_type capacity, const_reference value)
-        : CircularBuffer(capacity) {
-    for (size_type i = 0; i < capacity; ++i) {
-        push(value);
-    }
-}
-
-template<typename T>
-CircularBuffer<T>::CircularBuffer(std::initializer_list<T> init)
-        : CircularBuffer(init.size()) {
-    for (const auto& item : init) {
-        push(item);
-    }
-}
-
-template<typename T>
-CircularBuffer<T>::CircularBuffer(const CircularBuffer& other)
-        : buffer_(std::make_unique<T[]>(other.capacity_))
-        , capacity_(other.capacity_)
-        , head_(other.head_)
-        , tail_(other.tail_)
-        , size_(other.size_) {
-
-    for (size_type i = 0; i < capacity_; ++i) {
-        buffer_[i] = other.buffer_[i];
-    }
-}
-
-template<typename T>
-CircularBuffer<T>::CircularBuffer(CircularBuffer&& other) noexcept
-        : buffer_(std::move(other.buffer_))
-        , capacity_(other.capacity_)
-        , head_(other.head_)
-        , tail_(other.tail_)
-        , size_(other.size_) {
-
-    other.capacity_ = 0;
-    other.head_ = 0;
-    other.tail_ = 0;
-    other.size_ = 0;
-    other.buffer_.reset();
-}
-
-template<typename T>
-CircularBuffer<T>& CircularBuffer<T>::operator=(const CircularBuffer& other) {
-    if (this != &other) {
-        auto temp = std::make_unique<T[]>(other.capacity_);
-
-        for (size_type i = 0; i < other.capacity_; ++i) {
-            temp[i] = other.buffer_[i];
-        }
-
-        buffer_ = std::move(temp);
-        capacity_ = other.capacity_;
-        head_ = other.head_;
-        tail_ = other.tail_;
-        size_ = other.size_;
-    }
-    return *this;
-}
-
-template<typename T>
-CircularBuffer<T>& CircularBuffer<T>::operator=(CircularBuffer&& other) noexcept {
-    if (this != &other) {
-        buffer_ = std::move(other.buffer_);
-        capacity_ = other.capacity_;
-        head_ = other.head_;
-        tail_ = other.tail_;
-        size_ = other.size_;
-
-        other.capacity_ = 0;
-        other.head_ = 0;
-        other.tail_ = 0;
-        other.size_ = 0;
-        other.buffer_.reset();
-    }
-    return *this;
-}
-
-template<typename T>
-CircularBuffer<T>::~CircularBuffer() = default;
-
-template<typename T>
-typename CircularBuffer<T>::size_type
-CircularBuffer<T>::next_index(size_type index) const noexcept {
-    return (index + 1) % capacity_;
-}
-
-template<typename T>
-void CircularBuffer<T>::advance_head() noexcept {
-    if (full()) {
-        tail_ = next_index(tail_);
-    } else {
-        ++size_;
-    }
-    head_ = next_index(head_);
-}
-
-template<typename T>
-void CircularBuffer<T>::advance_tail() noexcept {
-    if (!empty()) {
-        tail_ = next_index(tail_);
-        --size_;
-    }
-}
-
-template<typename T>
-typename CircularBuffer<T>::reference CircularBuffer<T>::front() {
-    if (empty()) {
-        throw std::runtime_error("Buffer is empty");
-    }
-    return buffer_[tail_];
-}
-
-template<typename T>
-typename CircularBuffer<T>::const_reference CircularBuffer<T>::front() const {
-    if (empty()) {
-        throw std::runtime_error("Buffer is empty");
-    }
-    return buffer_[tail_];
-}
-
-template<typename T>
-typename CircularBuffer<T>::reference CircularBuffer<T>::back() {
-    if (empty()) {
-        throw std::runtime_error("Buffer is empty");
-    }
-    return buffer_[(head_ == 0 ? capacity_ : head_) - 1];
-}
-
-template<typename T>
-typename CircularBuffer<T>::const_reference CircularBuffer<T>::back() const {
-    if (empty()) {
-        throw std::runtime_error("Buffer is empty");
-    }
-    return buffer_[(head_ == 0 ? capacity_ : head_) - 1];
-}
-
-template<typename T>
-typename CircularBuffer<T>::reference CircularBuffer<T>::operator[](size_type index) {
-    if (index >= size_) {
-        throw std::out_of_range("Index out of range");
-    }
-    return buffer_[(tail_ + index) % capacity_];
-}
-
-template<typename T>
-typename CircularBuffer<T>::const_reference
-CircularBuffer<T>::operator[](size_type index) const {
-    if (index >= size_) {
-        throw std::out_of_range("Index out of range");
-    }
-    return buffer_[(tail_ + index) % capacity_];
-}
-
-template<typename T>
-bool CircularBuffer<T>::empty() const noexcept {
-    return size_ == 0;
-}
-
-template<typename T>
-bool CircularBuffer<T>::full() const noexcept {
-    return size_ == capacity_;
-}
-
-template<typename T>
-typename CircularBuffer<T>::size_type CircularBuffer<T>::size() const noexcept {
-    return size_;
-}
-
-template<typename T>
-typename CircularBuffer<T>::size_type CircularBuffer<T>::capacity() const noexcept {
-    return capacity_;
-}
-
-template<typename T>
-void CircularBuffer<T>::push(const_reference value) {
-    buffer_[head_] = value;
-    advance_head();
-}
-
-template<typename T>
-void CircularBuffer<T>::push(T&& value) {
-    buffer_[head_] = std::move(value);
-    advance_head();
-}
-
-template<typename T>
-template<typename... Args>
-void CircularBuffer<T>::emplace(Args&&... args) {
-    buffer_[head_] = T(std::forward<Args>(args)...);
-    advance_head();
-}
-
-template<typename T>
-void CircularBuffer<T>::pop() {
-    if (empty()) {
-        throw std::runtime_error("Buffer is empty");
-    }
-    advance_tail();
-}
-
-template<typename T>
-void CircularBuffer<T>::clear() noexcept {
-    head_ = 0;
-    tail_ = 0;
-    size_ = 0;
-}
-
-template<typename T>
-void CircularBuffer<T>::resize(size_type new_capacity) {
-    if (new_capacity == 0) {
-        throw std::invalid_argument("Capacity must be greater than 0");
-    }
-
-    if (new_capacity == capacity_) {
-        return;
-    }
-
-    auto new_buffer = std::make_unique<T[]>(new_capacity);
-    size_type elements_to_copy = std::min(size_, new_capacity);
-
-    for (size_type i = 0; i < elements_to_copy; ++i) {
-        new_buffer[i] = std::move((*this)[i]);
-    }
-
-    buffer_ = std::move(new_buffer);
-    capacity_ = new_capacity;
-    head_ = elements_to_copy;
-    tail_ = 0;
-    size_ = elements_to_copy;
-}
-
-
-template<typename T>
-void CircularBuffer<T>::saveToFile(const std::string& filename) const {
-    std::ofstream file(filename, std::ios::binary);
-    if (!file) {
-        throw std::runtime_error("Cannot open file for writing: " + filename);
-    }
-
-    file.write(reinterpret_cast<const char*>(&capacity_), sizeof(capacity_));
-    file.write(reinterpret_cast<const char*>(&size_), sizeof(size_));
-    file.write(reinterpret_cast<const char*>(&head_), sizeof(head_));
-    file.write(reinterpret_cast<const char*>(&tail_), sizeof(tail_));
-
-    for (size_type i = 0; i < size_; ++i) {
-        const T& element = buffer_[(tail_ + i) % capacity_];
-        file.write(reinterpret_cast<const char*>(&element), sizeof(T));
-    }
-}
-
-template<typename T>
-void CircularBuffer<T>::loadFromFile(const std::string& filename) {
-    std::ifstream file(filename, std::ios::binary);
-    if (!file) {
-        throw std::runtime_error("Cannot open file for reading: " + filename);
-    }
-
-    size_type new_capacity, new_size, new_head, new_tail;
-    file.read(reinterpret_cast<char*>(&new_capacity), sizeof(new_capacity));
-    file.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
-    file.read(reinterpret_cast<char*>(&new_head), sizeof(new_head));
-    file.read(reinterpret_cast<char*>(&new_tail), sizeof(new_tail));
-
-    if (new_capacity != capacity_) {
-        buffer_ = std::make_unique<T[]>(new_capacity);
-        capacity_ = new_capacity;
-    }
-
-    head_ = new_head;
-    tail_ = new_tail;
-    size_ = new_size;
-
-    for (size_type i = 0; i < size_; ++i) {
-        T element;
-        file.read(reinterpret_cast<char*>(&element), sizeof(T));
-        buffer_[(tail_ + i) % capacity_] = element;
-    }
-
-    if (!file) {
-        throw std::runtime_error("Error reading from file: " + filename);
-    }
-}
-
-template<typename T>
-void CircularBuffer<T>::saveToTextFile(const std::string& filename) const {
-    std::ofstream file(filename);
-    if (!file) {
-        throw std::runtime_error("Cannot open file for writing: " + filename);
-    }
-
-    file << capacity_ << " " << size_ << " " << head_ << " " << tail_ << "\n";
-    for (size_type i = 0; i < size_; ++i) {
-        file << buffer_[(tail_ + i) % capacity_] << " ";
-    }
-    file << "\n";
-}
-
-template<typename T>
-void CircularBuffer<T>::loadFromTextFile(const std::string& filename) {
-    std::ifstream file(filename);
-    if (!file) {
-        throw std::runtime_error("Cannot open file for reading: " + filename);
-    }
-
-    size_type new_capacity, new_size, new_head, new_tail;
-    file >> new_capacity >> new_size >> new_head >> new_tail;
-
-    if (new_capacity != capacity_) {
-        buffer_ = std::make_unique<T[]>(new_capacity);
-        capacity_ = new_capacity;
-    }
-
-    head_ = new_head;
-    tail_ = new_tail;
-    size_ = new_size;
-
-    for (size_type i = 0; i < size_; ++i) {
-        file >> buffer_[(tail_ + i) % capacity_];
-    }
-
-    if (!file) {
-        throw std::runtime_error("Error reading from file: " + filename);
-    }
-}
-
-template<typename T>
-class CircularBuffer<T>::iterator {
-public:
-    using pointer = T*;
-    using reference = T&;
-
-    iterator(CircularBuffer* buffer, size_type pos)
-            : buffer_(buffer), pos_(pos) {}
-
-    reference operator*() const {
-        return (*buffer_)[pos_];
-    }
-
-    pointer operator->() const {
-        return &(*buffer_)[pos_];
-    }
-
-    iterator& operator++() {
-        ++pos_;
-        return *this;
-    }
-
-    iterator operator++(int) {
-        iterator temp = *this;
-        ++pos_;
-        return temp;
-    }
-
-    bool operator==(const iterator& other) const {
-        return buffer_ == other.buffer_ && pos_ == other.pos_;
-    }
-
-    bool operator!=(const iterator& other) const {
-        return !(*this == other);
-    }
-
-private:
-    CircularBuffer* buffer_;
-    size_type pos_;
-};
-
-template<typename T>
-class CircularBuffer<T>::const_iterator {
-public:
-    using pointer = const T*;
-    using reference = const T&;
-
-    const_iterator(const CircularBuffer* buffer, size_type pos)
-            : buffer_(buffer), pos_(pos) {}
-
-    reference operator*() const {
-        return (*buffer_)[pos_];
-    }
-
-    pointer operator->() const {
-        return &(*buffer_)[pos_];
-    }
-
-    const_iterator& operator++() {
-        ++pos_;
-        return *this;
-    }
-
-    const_iterator operator++(int) {
-        const_iterator temp = *this;
-        ++pos_;
-        return temp;
-    }
-
-    bool operator==(const const_iterator& other) const {
-        return buffer_ == other.buffer_ && pos_ == other.pos_;
-    }
-
-    bool operator!=(const const_iterator& other) const {
-        return !(*this == other);
-    }
-
-private:
-    const CircularBuffer* buffer_;
-    size_type pos_;
-};
-
-template<typename T>
-typename CircularBuffer<T>::iterator CircularBuffer<T>::begin() noexcept {
-    return iterator(this, 0);
-}
-
-template<typename T>
-typename CircularBuffer<T>::const_iterator CircularBuffer<T>::begin() const noexcept {
-    return const_iterator(this, 0);
-}
-
-template<typename T>
-typename CircularBuffer<T>::const_iterator CircularBuffer<T>::cbegin() const noexcept {
-    return begin();
-}
-
-template<typename T>
-typename CircularBuffer<T>::iterator CircularBuffer<T>::end() noexcept {
-    return iterator(this, size_);
-}
-
-template<typename T>
-typename CircularBuffer<T>::const_iterator CircularBuffer<T>::end() const noexcept {
-    return const_iterator(this, size_);
-}
-
-template<typename T>
-typename CircularBuffer<T>::const_iterator CircularBuffer<T>::cend() const noexcept {
-    return end();
-}
-
+#ifndef CIRCULAR_BUFFER_HPP
+#define CIRCULAR_BUFFER_HPP
+
+#include "crc32.hpp"
+#include "mirrored_memory.hpp"
+
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#if __has_include(<span>) && __cplusplus >= 202002L
+#include <span>
+#endif
+#if __has_include(<memory_resource>)
+#include <memory_resource>
+#endif
+
+struct ModuloCapacity {
+    static constexpr bool power_of_two = false;
+
+    static std::size_t round_up(std::size_t capacity) noexcept {
+        return capacity;
+    }
+};
+
+struct PowerOfTwoCapacity {
+    static constexpr bool power_of_two = true;
+
+    static std::size_t round_up(std::size_t capacity) {
+        if (capacity > (std::numeric_limits<std::size_t>::max() >> 1) + 1) {
+            throw std::length_error("Capacity is too large");
+        }
+        std::size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        return rounded;
+    }
+};
+
+struct OverwriteOldest {
+    static constexpr bool overwrite = true;
+    static constexpr bool grow = false;
+    static constexpr bool count_overflow = true;
+};
+
+struct RejectNewest {
+    static constexpr bool overwrite = false;
+    static constexpr bool grow = false;
+    static constexpr bool count_overflow = false;
+};
+
+struct DropNewest {
+    static constexpr bool overwrite = false;
+    static constexpr bool grow = false;
+    static constexpr bool count_overflow = true;
+};
+
+struct GrowCapacity {
+    static constexpr bool overwrite = false;
+    static constexpr bool grow = true;
+    static constexpr bool count_overflow = false;
+
+    static std::size_t next_capacity(std::size_t capacity) {
+        if (capacity > std::numeric_limits<std::size_t>::max() / 2) {
+            throw std::length_error("Capacity is too large");
+        }
+        return capacity * 2;
+    }
+};
+
+template<typename T, typename Enable = void>
+struct CircularBufferSerializer;
+
+template<typename CharT, typename Traits, typename Alloc>
+struct CircularBufferSerializer<std::basic_string<CharT, Traits, Alloc>> {
+    using string_type = std::basic_string<CharT, Traits, Alloc>;
+
+    static void write(std::ostream& out, const string_type& value) {
+        const std::uint64_t length = value.size();
+        out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.write(reinterpret_cast<const char*>(value.data()),
+                  static_cast<std::streamsize>(length * sizeof(CharT)));
+    }
+
+    static string_type read(std::istream& in) {
+        std::uint64_t length = 0;
+        in.read(reinterpret_cast<char*>(&length), sizeof(length));
+        if (!in || length > static_cast<std::uint64_t>(std::numeric_limits<std::streamsize>::max()) / sizeof(CharT)) {
+            throw std::runtime_error("Invalid string in snapshot");
+        }
+        string_type value(static_cast<std::size_t>(length), CharT());
+        if (!in.read(reinterpret_cast<char*>(value.data()), static_cast<std::streamsize>(length * sizeof(CharT)))) {
+            throw std::runtime_error("Invalid string in snapshot");
+        }
+        return value;
+    }
+};
+
+struct MirroredStorage {
+    bool enabled = true;
+};
+
+template<typename T, typename CapacityPolicy = ModuloCapacity, typename Allocator = std::allocator<T>,
+         typename OverflowPolicy = OverwriteOldest>
+class CircularBuffer {
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same_v<typename alloc_traits::value_type, T>,
+                  "CircularBuffer requires an allocator for its element type");
+    static_assert(std::is_same_v<typename alloc_traits::pointer, T*>,
+                  "CircularBuffer requires an allocator with raw pointers");
+
+public:
+    using allocator_type = Allocator;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using array_range = std::pair<pointer, size_type>;
+    using const_array_range = std::pair<const_pointer, size_type>;
+
+    explicit CircularBuffer(size_type capacity, const allocator_type& allocator = allocator_type());
+    CircularBuffer(size_type capacity, MirroredStorage storage, const allocator_type& allocator = allocator_type());
+    CircularBuffer(size_type capacity, const_reference value, const allocator_type& allocator = allocator_type());
+    CircularBuffer(std::initializer_list<T> init, const allocator_type& allocator = allocator_type());
+
+    CircularBuffer(const CircularBuffer& other);
+    CircularBuffer(const CircularBuffer& other, const allocator_type& allocator);
+    CircularBuffer(CircularBuffer&& other) noexcept;
+    CircularBuffer(CircularBuffer&& other, const allocator_type& allocator);
+    CircularBuffer& operator=(const CircularBuffer& other);
+    CircularBuffer& operator=(CircularBuffer&& other) noexcept(
+            alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
+    ~CircularBuffer();
+
+    [[nodiscard]] allocator_type get_allocator() const noexcept;
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+    reference operator[](size_type index);
+    const_reference operator[](size_type index) const;
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] bool full() const noexcept;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] bool is_mirrored() const noexcept;
+    [[nodiscard]] std::uint64_t overflow_count() const noexcept;
+
+    array_range array_one() noexcept;
+    const_array_range array_one() const noexcept;
+    array_range array_two() noexcept;
+    const_array_range array_two() const noexcept;
+#ifdef __cpp_lib_span
+    std::pair<std::span<T>, std::span<T>> segments() noexcept;
+    std::pair<std::span<const T>, std::span<const T>> segments() const noexcept;
+#endif
+    [[nodiscard]] bool is_linearized() const noexcept;
+    pointer linearize();
+
+    bool push(const_reference value);
+    bool push(T&& value);
+    template<typename... Args>
+    bool emplace(Args&&... args);
+    void pop();
+    template<typename InputIt>
+    size_type push_range(InputIt first, InputIt last);
+    size_type pop_n(size_type count);
+    template<typename OutputIt>
+    OutputIt pop_into(OutputIt out, size_type count);
+    size_type write(const T* data, size_type count);
+    size_type read(T* out, size_type count);
+#ifdef __cpp_lib_span
+    size_type write(std::span<const T> data);
+    size_type read(std::span<T> out);
+#endif
+    void clear() noexcept;
+    void resize(size_type new_capacity);
+    void shrink_to_fit();
+
+    void saveToFile(const std::string& filename) const;
+    void loadFromFile(const std::string& filename);
+    void saveSnapshot(const std::string& filename) const;
+    void loadSnapshot(const std::string& filename);
+    void saveToTextFile(const std::string& filename) const;
+    void loadFromTextFile(const std::string& filename);
+
+    template<typename ValueType>
+    class basic_iterator;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+private:
+    pointer buffer_;
+    size_type capacity_;
+    size_type allocated_;
+    size_type head_;
+    size_type tail_;
+    size_type size_;
+    std::uint64_t overflow_count_;
+    bool mirrored_;
+    allocator_type allocator_;
+
+    struct SnapshotHeader {
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t endianness;
+        std::uint64_t element_size;
+        std::uint64_t capacity;
+        std::uint64_t size;
+        std::uint64_t payload_bytes;
+        std::uint32_t payload_crc;
+        std::uint32_t header_crc;
+    };
+
+    static constexpr char snapshot_magic[8] = {'C', 'I', 'R', 'C', 'B', 'U', 'F', '\0'};
+    static constexpr std::uint32_t snapshot_version = 1;
+    static constexpr std::uint32_t snapshot_endianness = 0x01020304;
+    static constexpr bool fast_text =
+            std::is_floating_point_v<T> ||
+            (std::is_integral_v<T> && sizeof(T) > 1 && !std::is_same_v<T, wchar_t> &&
+             !std::is_same_v<T, char16_t> && !std::is_same_v<T, char32_t>);
+
+    pointer allocate(size_type capacity, bool& mirrored);
+    void deallocate(pointer buffer, size_type capacity, bool mirrored) noexcept;
+    template<typename... Args>
+    void construct_element(pointer slot, Args&&... args);
+    void destroy_element(pointer slot) noexcept;
+
+    size_type slot_index(size_type position) const noexcept;
+    size_type head_slot() const noexcept;
+    size_type back_slot() const noexcept;
+    size_type tail_slot() const noexcept;
+    size_type next_index(size_type index) const noexcept;
+    size_type advance_index(size_type index, size_type count) const noexcept;
+    size_type contiguous_capacity(size_type slot) const noexcept;
+    void advance_head() noexcept;
+    void overwrite_head() noexcept;
+    void reject_overflow() noexcept;
+    template<typename... Args>
+    void grow_and_emplace(Args&&... args);
+    void grow_to(size_type required);
+    void advance_tail() noexcept;
+    void commit_push(size_type count) noexcept;
+    void discard_front(size_type count) noexcept;
+    void destroy_elements() noexcept;
+    void reset_storage(size_type new_capacity, size_type start);
+    void relocate_to_front(size_type start, size_type count);
+    void reallocate(size_type new_capacity, size_type count);
+    void append_from(const CircularBuffer& other);
+    void swap(CircularBuffer& other) noexcept;
+};
+
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::CircularBuffer(size_type capacity,
+                                                                             const allocator_type& allocator)
+        : CircularBuffer(capacity, MirroredStorage{false}, allocator) {
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::CircularBuffer(size_type capacity,
+                                                                             MirroredStorage storage,
+                                                                             const allocator_type& allocator)
+        : buffer_(nullptr)
+        , capacity_(CapacityPolicy::round_up(capacity))
+        , allocated_(capacity_)
+        , head_(0)
+        , tail_(0)
+        , size_(0)
+        , overflow_count_(0)
+        , mirrored_(storage.enabled)
+        , allocator_(allocator) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Capacity must be greater than 0");
+    }
+    buffer_ = allocate(capacity_, mirrored_);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::CircularBuffer(size_type capacity, const_reference value,
+                                                                             const allocator_type& allocator)
+        : CircularBuffer(capacity, allocator) {
+    for (size_type i = 0; i < capacity_; ++i) {
+        push(value);
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::CircularBuffer(std::initializer_list<T> init,
+                                                                             const allocator_type& allocator)
+        : CircularBuffer(init.size(), allocator) {
+    for (const auto& item : init) {
+        push(item);
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::CircularBuffer(const CircularBuffer& other)
+        : CircularBuffer(other, alloc_traits::select_on_container_copy_construction(other.allocator_)) {
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::CircularBuffer(const CircularBuffer& other,
+                                                                             const allocator_type& allocator)
+        : buffer_(nullptr)
+        , capacity_(0)
+        , allocated_(0)
+        , head_(0)
+        , tail_(0)
+        , size_(0)
+        , overflow_count_(0)
+        , mirrored_(false)
+        , allocator_(allocator) {
+    if (other.capacity_ == 0) {
+        return;
+    }
+
+    CircularBuffer temp(other.capacity_, MirroredStorage{other.mirrored_}, allocator_);
+    temp.append_from(other);
+    temp.overflow_count_ = other.overflow_count_;
+    swap(temp);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::CircularBuffer(CircularBuffer&& other) noexcept
+        : buffer_(other.buffer_)
+        , capacity_(other.capacity_)
+        , allocated_(other.allocated_)
+        , head_(other.head_)
+        , tail_(other.tail_)
+        , size_(other.size_)
+        , overflow_count_(other.overflow_count_)
+        , mirrored_(other.mirrored_)
+        , allocator_(std::move(other.allocator_)) {
+
+    other.buffer_ = nullptr;
+    other.capacity_ = 0;
+    other.allocated_ = 0;
+    other.head_ = 0;
+    other.tail_ = 0;
+    other.size_ = 0;
+    other.overflow_count_ = 0;
+    other.mirrored_ = false;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::CircularBuffer(CircularBuffer&& other,
+                                                                             const allocator_type& allocator)
+        : buffer_(nullptr)
+        , capacity_(0)
+        , allocated_(0)
+        , head_(0)
+        , tail_(0)
+        , size_(0)
+        , overflow_count_(0)
+        , mirrored_(false)
+        , allocator_(allocator) {
+    if (other.buffer_ == nullptr || other.mirrored_ || allocator_ == other.allocator_) {
+        swap(other);
+        return;
+    }
+
+    CircularBuffer temp(other.capacity_, allocator_);
+    for (auto& item : other) {
+        temp.push(std::move(item));
+    }
+    swap(temp);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>&
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::operator=(const CircularBuffer& other) {
+    if (this == &other) {
+        return *this;
+    }
+    if constexpr (alloc_traits::propagate_on_container_copy_assignment::value) {
+        if (allocator_ != other.allocator_) {
+            CircularBuffer temp(other, other.allocator_);
+            swap(temp);
+            std::swap(allocator_, temp.allocator_);
+            return *this;
+        }
+        allocator_ = other.allocator_;
+    }
+
+    if (other.capacity_ != 0 && (other.capacity_ == capacity_ || (!mirrored_ && other.capacity_ <= allocated_))) {
+        clear();
+        capacity_ = other.capacity_;
+        append_from(other);
+        overflow_count_ = other.overflow_count_;
+    } else {
+        CircularBuffer temp(other, allocator_);
+        swap(temp);
+    }
+    return *this;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>&
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::operator=(CircularBuffer&& other) noexcept(
+        alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value) {
+    if (this != &other) {
+        if constexpr (alloc_traits::propagate_on_container_move_assignment::value) {
+            CircularBuffer temp(std::move(other));
+            swap(temp);
+            std::swap(allocator_, temp.allocator_);
+        } else {
+            CircularBuffer temp(std::move(other), allocator_);
+            swap(temp);
+        }
+    }
+    return *this;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::~CircularBuffer() {
+    destroy_elements();
+    deallocate(buffer_, allocated_, mirrored_);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::allocator_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::get_allocator() const noexcept {
+    return allocator_;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::pointer
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::allocate(size_type capacity, bool& mirrored) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (mirrored && capacity <= std::numeric_limits<size_type>::max() / (2 * sizeof(T))) {
+            if (void* memory = MirroredMemory::allocate(capacity * sizeof(T))) {
+                return static_cast<pointer>(memory);
+            }
+        }
+    }
+    mirrored = false;
+    return alloc_traits::allocate(allocator_, capacity);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::deallocate(pointer buffer, size_type capacity,
+                                                                         bool mirrored) noexcept {
+    if (buffer == nullptr) {
+        return;
+    }
+    if (mirrored) {
+        MirroredMemory::deallocate(buffer, capacity * sizeof(T));
+    } else {
+        alloc_traits::deallocate(allocator_, buffer, capacity);
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+template<typename... Args>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::construct_element(pointer slot, Args&&... args) {
+    alloc_traits::construct(allocator_, slot, std::forward<Args>(args)...);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::destroy_element(pointer slot) noexcept {
+    alloc_traits::destroy(allocator_, slot);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::destroy_elements() noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (size_type i = 0, count = size(); i < count; ++i) {
+            destroy_element(buffer_ + slot_index(tail_ + i));
+        }
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::reset_storage(size_type new_capacity,
+                                                                                 size_type start) {
+    clear();
+    new_capacity = CapacityPolicy::round_up(new_capacity);
+    if (mirrored_ ? new_capacity != capacity_ : new_capacity > allocated_) {
+        bool mirrored = mirrored_;
+        pointer new_buffer = allocate(new_capacity, mirrored);
+        deallocate(buffer_, allocated_, mirrored_);
+        buffer_ = new_buffer;
+        allocated_ = new_capacity;
+        mirrored_ = mirrored;
+    }
+    capacity_ = new_capacity;
+    head_ = start;
+    tail_ = start;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::relocate_to_front(size_type start, size_type count) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::memmove(buffer_, buffer_ + start, count * sizeof(T));
+    } else {
+        for (size_type i = 0; i < count; ++i) {
+            construct_element(buffer_ + i, std::move(buffer_[start + i]));
+            destroy_element(buffer_ + start + i);
+        }
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::append_from(const CircularBuffer& other) {
+    const auto [first, first_size] = other.array_one();
+    push_range(first, first + first_size);
+    const auto [second, second_size] = other.array_two();
+    push_range(second, second + second_size);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::swap(CircularBuffer& other) noexcept {
+    std::swap(buffer_, other.buffer_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(allocated_, other.allocated_);
+    std::swap(head_, other.head_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+    std::swap(overflow_count_, other.overflow_count_);
+    std::swap(mirrored_, other.mirrored_);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::slot_index(size_type position) const noexcept {
+    if constexpr (CapacityPolicy::power_of_two) {
+        return position & (capacity_ - 1);
+    } else {
+        return position % capacity_;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::head_slot() const noexcept {
+    if constexpr (CapacityPolicy::power_of_two) {
+        return slot_index(head_);
+    } else {
+        return head_;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::back_slot() const noexcept {
+    if constexpr (CapacityPolicy::power_of_two) {
+        return slot_index(head_ - 1);
+    } else {
+        return (head_ == 0 ? capacity_ : head_) - 1;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::tail_slot() const noexcept {
+    if constexpr (CapacityPolicy::power_of_two) {
+        return slot_index(tail_);
+    } else {
+        return tail_;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::next_index(size_type index) const noexcept {
+    if constexpr (CapacityPolicy::power_of_two) {
+        return index + 1;
+    } else {
+        return (index + 1) % capacity_;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::advance_index(size_type index,
+                                                                            size_type count) const noexcept {
+    if constexpr (CapacityPolicy::power_of_two) {
+        return index + count;
+    } else {
+        return (index + count) % capacity_;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::contiguous_capacity(size_type slot) const noexcept {
+    return mirrored_ ? capacity_ : capacity_ - slot;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::advance_head() noexcept {
+    if constexpr (!CapacityPolicy::power_of_two) {
+        ++size_;
+    }
+    head_ = next_index(head_);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::overwrite_head() noexcept {
+    head_ = next_index(head_);
+    tail_ = next_index(tail_);
+    ++overflow_count_;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::reject_overflow() noexcept {
+    if constexpr (OverflowPolicy::count_overflow) {
+        ++overflow_count_;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+template<typename... Args>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::grow_and_emplace(Args&&... args) {
+    T value(std::forward<Args>(args)...);
+    grow_to(capacity_ + 1);
+    construct_element(buffer_ + head_slot(), std::move(value));
+    advance_head();
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::grow_to(size_type required) {
+    size_type new_capacity = capacity_;
+    while (new_capacity < required) {
+        new_capacity = OverflowPolicy::next_capacity(new_capacity);
+    }
+    resize(new_capacity);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::advance_tail() noexcept {
+    if (!empty()) {
+        destroy_element(buffer_ + tail_slot());
+        tail_ = next_index(tail_);
+        if constexpr (!CapacityPolicy::power_of_two) {
+            --size_;
+        }
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::commit_push(size_type count) noexcept {
+    head_ = advance_index(head_, count);
+    if constexpr (!CapacityPolicy::power_of_two) {
+        size_ += count;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::discard_front(size_type count) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        const size_type start = tail_slot();
+        const size_type first_segment = std::min(count, capacity_ - start);
+        for (size_type i = 0; i < first_segment; ++i) {
+            destroy_element(buffer_ + start + i);
+        }
+        for (size_type i = first_segment; i < count; ++i) {
+            destroy_element(buffer_ + (i - first_segment));
+        }
+    }
+    tail_ = advance_index(tail_, count);
+    if constexpr (!CapacityPolicy::power_of_two) {
+        size_ -= count;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::reference
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::front() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return buffer_[tail_slot()];
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::const_reference
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::front() const {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return buffer_[tail_slot()];
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::reference
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::back() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return buffer_[back_slot()];
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::const_reference
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::back() const {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return buffer_[back_slot()];
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::reference
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::operator[](size_type index) {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return buffer_[slot_index(tail_ + index)];
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::const_reference
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::operator[](size_type index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return buffer_[slot_index(tail_ + index)];
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+bool CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::empty() const noexcept {
+    return size() == 0;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+bool CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::full() const noexcept {
+    return size() == capacity_;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size() const noexcept {
+    if constexpr (CapacityPolicy::power_of_two) {
+        return head_ - tail_;
+    } else {
+        return size_;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::capacity() const noexcept {
+    return capacity_;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+bool CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::is_mirrored() const noexcept {
+    return mirrored_;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+std::uint64_t CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::overflow_count() const noexcept {
+    return overflow_count_;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::array_range
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::array_one() noexcept {
+    return array_range(buffer_ + tail_slot(), std::min(size(), contiguous_capacity(tail_slot())));
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::const_array_range
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::array_one() const noexcept {
+    return const_array_range(buffer_ + tail_slot(), std::min(size(), contiguous_capacity(tail_slot())));
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::array_range
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::array_two() noexcept {
+    return array_range(buffer_, size() - array_one().second);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::const_array_range
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::array_two() const noexcept {
+    return const_array_range(buffer_, size() - array_one().second);
+}
+
+#ifdef __cpp_lib_span
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+std::pair<std::span<T>, std::span<T>>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::segments() noexcept {
+    const auto [first, first_size] = array_one();
+    const auto [second, second_size] = array_two();
+    return {std::span<T>(first, first_size), std::span<T>(second, second_size)};
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+std::pair<std::span<const T>, std::span<const T>>
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::segments() const noexcept {
+    const auto [first, first_size] = array_one();
+    const auto [second, second_size] = array_two();
+    return {std::span<const T>(first, first_size), std::span<const T>(second, second_size)};
+}
+#endif
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+bool CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::is_linearized() const noexcept {
+    return array_two().second == 0;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::pointer
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::linearize() {
+    if (is_linearized()) {
+        return buffer_ + tail_slot();
+    }
+
+    const size_type count = size();
+    const size_type first_size = capacity_ - tail_slot();
+    const size_type second_size = count - first_size;
+    pointer first = buffer_ + tail_slot();
+
+    if (first != buffer_ + second_size) {
+        if constexpr (std::is_trivially_copyable_v<T>) {
+            std::memmove(buffer_ + second_size, first, first_size * sizeof(T));
+        } else {
+            for (size_type i = 0; i < first_size; ++i) {
+                construct_element(buffer_ + second_size + i, std::move(first[i]));
+                destroy_element(first + i);
+            }
+        }
+    }
+    std::rotate(buffer_, buffer_ + second_size, buffer_ + count);
+
+    tail_ = 0;
+    head_ = advance_index(0, count);
+    return buffer_;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+bool CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::push(const_reference value) {
+    if (full()) {
+        if constexpr (OverflowPolicy::overwrite) {
+            buffer_[head_slot()] = value;
+            overwrite_head();
+            return true;
+        } else if constexpr (OverflowPolicy::grow) {
+            grow_and_emplace(value);
+            return true;
+        } else {
+            reject_overflow();
+            return false;
+        }
+    }
+    construct_element(buffer_ + head_slot(), value);
+    advance_head();
+    return true;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+bool CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::push(T&& value) {
+    if (full()) {
+        if constexpr (OverflowPolicy::overwrite) {
+            buffer_[head_slot()] = std::move(value);
+            overwrite_head();
+            return true;
+        } else if constexpr (OverflowPolicy::grow) {
+            grow_and_emplace(std::move(value));
+            return true;
+        } else {
+            reject_overflow();
+            return false;
+        }
+    }
+    construct_element(buffer_ + head_slot(), std::move(value));
+    advance_head();
+    return true;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+template<typename... Args>
+bool CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::emplace(Args&&... args) {
+    if (full()) {
+        if constexpr (OverflowPolicy::overwrite) {
+            advance_tail();
+            ++overflow_count_;
+        } else if constexpr (OverflowPolicy::grow) {
+            grow_and_emplace(std::forward<Args>(args)...);
+            return true;
+        } else {
+            reject_overflow();
+            return false;
+        }
+    }
+    construct_element(buffer_ + head_slot(), std::forward<Args>(args)...);
+    advance_head();
+    return true;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::pop() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    advance_tail();
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+template<typename InputIt>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::push_range(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (!std::is_base_of_v<std::forward_iterator_tag, category>) {
+        size_type accepted = 0;
+        for (; first != last; ++first) {
+            accepted += push(*first) ? 1 : 0;
+        }
+        return accepted;
+    } else {
+        auto count = static_cast<size_type>(std::distance(first, last));
+        const size_type accepted = OverflowPolicy::overwrite || OverflowPolicy::grow
+                                   ? count
+                                   : std::min(count, capacity_ - size());
+        if constexpr (OverflowPolicy::overwrite) {
+            if (size() + count > capacity_) {
+                overflow_count_ += size() + count - capacity_;
+            }
+            if (count >= capacity_) {
+                std::advance(first, count - capacity_);
+                count = capacity_;
+                clear();
+            } else if (size() + count > capacity_) {
+                discard_front(size() + count - capacity_);
+            }
+        } else if constexpr (OverflowPolicy::grow) {
+            if (size() + count > capacity_) {
+                grow_to(size() + count);
+            }
+        } else {
+            if constexpr (OverflowPolicy::count_overflow) {
+                overflow_count_ += count - accepted;
+            }
+            count = accepted;
+        }
+
+        const size_type start = head_slot();
+        const size_type first_segment = std::min(count, contiguous_capacity(start));
+        for (const auto& [offset, length] : {std::pair<size_type, size_type>(start, first_segment),
+                                            std::pair<size_type, size_type>(0, count - first_segment)}) {
+            if constexpr (std::is_trivially_copyable_v<T> && std::is_pointer_v<InputIt> &&
+                          std::is_same_v<std::remove_cv_t<std::remove_pointer_t<InputIt>>, T>) {
+                if (length != 0) {
+                    std::memcpy(buffer_ + offset, first, length * sizeof(T));
+                }
+                std::advance(first, length);
+            } else {
+                size_type constructed = 0;
+                try {
+                    for (; constructed < length; ++constructed, ++first) {
+                        construct_element(buffer_ + offset + constructed, *first);
+                    }
+                } catch (...) {
+                    commit_push(constructed);
+                    throw;
+                }
+            }
+            commit_push(length);
+        }
+        return accepted;
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::pop_n(size_type count) {
+    count = std::min(count, size());
+    discard_front(count);
+    return count;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+template<typename OutputIt>
+OutputIt CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::pop_into(OutputIt out, size_type count) {
+    count = std::min(count, size());
+    const size_type first_segment = std::min(count, contiguous_capacity(tail_slot()));
+    for (const size_type length : {first_segment, count - first_segment}) {
+        pointer source = buffer_ + tail_slot();
+        if constexpr (std::is_trivially_copyable_v<T> && std::is_same_v<OutputIt, pointer>) {
+            if (length != 0) {
+                std::memcpy(out, source, length * sizeof(T));
+            }
+            out += length;
+        } else {
+            out = std::move(source, source + length, out);
+        }
+        discard_front(length);
+    }
+    return out;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::write(const T* data, size_type count) {
+    return push_range(data, data + count);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::read(T* out, size_type count) {
+    return static_cast<size_type>(pop_into(out, count) - out);
+}
+
+#ifdef __cpp_lib_span
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::write(std::span<const T> data) {
+    return write(data.data(), data.size());
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::size_type
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::read(std::span<T> out) {
+    return read(out.data(), out.size());
+}
+#endif
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::clear() noexcept {
+    destroy_elements();
+    head_ = 0;
+    tail_ = 0;
+    size_ = 0;
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::resize(size_type new_capacity) {
+    if (new_capacity == 0) {
+        throw std::invalid_argument("Capacity must be greater than 0");
+    }
+
+    new_capacity = CapacityPolicy::round_up(new_capacity);
+    if (new_capacity == capacity_) {
+        return;
+    }
+
+    const size_type elements_to_copy = std::min(size(), new_capacity);
+    if (!mirrored_ && new_capacity <= allocated_ && new_capacity >= allocated_ / 4) {
+        for (size_type i = elements_to_copy, count = size(); i < count; ++i) {
+            destroy_element(buffer_ + slot_index(tail_ + i));
+        }
+        head_ = advance_index(tail_, elements_to_copy);
+        if constexpr (!CapacityPolicy::power_of_two) {
+            size_ = elements_to_copy;
+        }
+
+        linearize();
+        size_type start = tail_slot();
+        if (start + elements_to_copy > new_capacity) {
+            relocate_to_front(start, elements_to_copy);
+            start = 0;
+        }
+        capacity_ = new_capacity;
+        tail_ = start;
+        if constexpr (CapacityPolicy::power_of_two) {
+            head_ = start + elements_to_copy;
+        } else {
+            head_ = (start + elements_to_copy) % new_capacity;
+        }
+        return;
+    }
+
+    reallocate(new_capacity, elements_to_copy);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::shrink_to_fit() {
+    if (mirrored_ || allocated_ == capacity_) {
+        return;
+    }
+    reallocate(capacity_, size());
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::reallocate(size_type new_capacity,
+                                                                              size_type count) {
+    bool mirrored = mirrored_;
+    pointer new_buffer = allocate(new_capacity, mirrored);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        const auto [first, first_size] = array_one();
+        const size_type first_count = std::min(count, first_size);
+        std::memcpy(new_buffer, first, first_count * sizeof(T));
+        std::memcpy(new_buffer + first_count, buffer_, (count - first_count) * sizeof(T));
+    } else {
+        size_type constructed = 0;
+        try {
+            for (auto source = begin(); constructed < count; ++constructed) {
+                construct_element(new_buffer + constructed, std::move(source[constructed]));
+            }
+        } catch (...) {
+            for (size_type i = 0; i < constructed; ++i) {
+                destroy_element(new_buffer + i);
+            }
+            deallocate(new_buffer, new_capacity, mirrored);
+            throw;
+        }
+    }
+
+    destroy_elements();
+    deallocate(buffer_, allocated_, mirrored_);
+    buffer_ = new_buffer;
+    capacity_ = new_capacity;
+    allocated_ = new_capacity;
+    mirrored_ = mirrored;
+    tail_ = 0;
+    if constexpr (CapacityPolicy::power_of_two) {
+        head_ = count;
+    } else {
+        head_ = count % new_capacity;
+        size_ = count;
+    }
+}
+
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::saveToFile(const std::string& filename) const {
+    std::ofstream file(filename, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open file for writing: " + filename);
+    }
+
+    const size_type count = size();
+    const size_type head = head_slot();
+    const size_type tail = tail_slot();
+    file.write(reinterpret_cast<const char*>(&capacity_), sizeof(capacity_));
+    file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    file.write(reinterpret_cast<const char*>(&head), sizeof(head));
+    file.write(reinterpret_cast<const char*>(&tail), sizeof(tail));
+
+    for (size_type i = 0; i < count; ++i) {
+        const T& element = buffer_[slot_index(tail_ + i)];
+        file.write(reinterpret_cast<const char*>(&element), sizeof(T));
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::loadFromFile(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open file for reading: " + filename);
+    }
+
+    size_type new_capacity, new_size, new_head, new_tail;
+    file.read(reinterpret_cast<char*>(&new_capacity), sizeof(new_capacity));
+    file.read(reinterpret_cast<char*>(&new_size), sizeof(new_size));
+    file.read(reinterpret_cast<char*>(&new_head), sizeof(new_head));
+    file.read(reinterpret_cast<char*>(&new_tail), sizeof(new_tail));
+    if (!file || new_capacity == 0 || new_size > new_capacity || new_tail >= new_capacity) {
+        throw std::runtime_error("Invalid buffer file: " + filename);
+    }
+
+    reset_storage(new_capacity, new_tail);
+
+    for (size_type i = 0; i < new_size; ++i) {
+        T element;
+        if (!file.read(reinterpret_cast<char*>(&element), sizeof(T))) {
+            break;
+        }
+        push(element);
+    }
+
+    if (!file) {
+        throw std::runtime_error("Error reading from file: " + filename);
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::saveSnapshot(const std::string& filename) const {
+    SnapshotHeader header{};
+    std::memcpy(header.magic, snapshot_magic, sizeof(header.magic));
+    header.version = snapshot_version;
+    header.endianness = snapshot_endianness;
+    header.element_size = sizeof(T);
+    header.capacity = capacity_;
+    header.size = size();
+
+    const auto [first, first_size] = array_one();
+    const auto [second, second_size] = array_two();
+    std::string payload;
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        header.payload_bytes = header.size * sizeof(T);
+        header.payload_crc = Crc32::update(Crc32::compute(first, first_size * sizeof(T)),
+                                           second, second_size * sizeof(T));
+    } else {
+        std::ostringstream out(std::ios::binary);
+        for (const auto& item : *this) {
+            CircularBufferSerializer<T>::write(out, item);
+        }
+        payload = std::move(out).str();
+        header.payload_bytes = payload.size();
+        header.payload_crc = Crc32::compute(payload.data(), payload.size());
+    }
+    header.header_crc = Crc32::compute(&header, offsetof(SnapshotHeader, header_crc));
+
+    std::ofstream file(filename, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open file for writing: " + filename);
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        file.write(reinterpret_cast<const char*>(first), static_cast<std::streamsize>(first_size * sizeof(T)));
+        file.write(reinterpret_cast<const char*>(second), static_cast<std::streamsize>(second_size * sizeof(T)));
+    } else {
+        file.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+    }
+    if (!file.flush()) {
+        throw std::runtime_error("Error writing to file: " + filename);
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::loadSnapshot(const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Cannot open file for reading: " + filename);
+    }
+
+    SnapshotHeader header{};
+    if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, snapshot_magic, sizeof(header.magic)) != 0) {
+        throw std::runtime_error("Not a buffer snapshot: " + filename);
+    }
+    if (header.header_crc != Crc32::compute(&header, offsetof(SnapshotHeader, header_crc))) {
+        throw std::runtime_error("Corrupted snapshot header: " + filename);
+    }
+    if (header.version != snapshot_version || header.endianness != snapshot_endianness ||
+        header.element_size != sizeof(T)) {
+        throw std::runtime_error("Incompatible snapshot format: " + filename);
+    }
+    if (header.capacity == 0 || header.size > header.capacity ||
+        header.capacity > std::numeric_limits<size_type>::max() / sizeof(T) ||
+        (std::is_trivially_copyable_v<T> && header.payload_bytes != header.size * sizeof(T))) {
+        throw std::runtime_error("Invalid snapshot header: " + filename);
+    }
+
+    CircularBuffer loaded(static_cast<size_type>(header.capacity), MirroredStorage{mirrored_}, allocator_);
+    const auto count = static_cast<size_type>(header.size);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (!file.read(reinterpret_cast<char*>(loaded.buffer_),
+                       static_cast<std::streamsize>(header.payload_bytes))) {
+            throw std::runtime_error("Truncated snapshot: " + filename);
+        }
+        if (Crc32::compute(loaded.buffer_, count * sizeof(T)) != header.payload_crc) {
+            throw std::runtime_error("Snapshot checksum mismatch: " + filename);
+        }
+        loaded.commit_push(count);
+    } else {
+        std::string payload(static_cast<size_type>(header.payload_bytes), '\0');
+        if (!file.read(payload.data(), static_cast<std::streamsize>(payload.size()))) {
+            throw std::runtime_error("Truncated snapshot: " + filename);
+        }
+        if (Crc32::compute(payload.data(), payload.size()) != header.payload_crc) {
+            throw std::runtime_error("Snapshot checksum mismatch: " + filename);
+        }
+        std::istringstream in(std::move(payload), std::ios::binary);
+        for (size_type i = 0; i < count; ++i) {
+            loaded.push(CircularBufferSerializer<T>::read(in));
+        }
+    }
+
+    swap(loaded);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::saveToTextFile(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file) {
+        throw std::runtime_error("Cannot open file for writing: " + filename);
+    }
+
+    const size_type count = size();
+    if constexpr (fast_text) {
+        constexpr size_type chunk_size = 1 << 16;
+        constexpr size_type max_field = 64;
+        std::unique_ptr<char[]> chunk(new char[chunk_size]);
+        char* const chunk_end = chunk.get() + chunk_size;
+        char* out = chunk.get();
+
+        for (const size_type field : {capacity_, count, head_slot(), tail_slot()}) {
+            out = std::to_chars(out, chunk_end, field).ptr;
+            *out++ = ' ';
+        }
+        out[-1] = '\n';
+
+        for (const auto& item : *this) {
+            if (chunk_end - out < static_cast<std::ptrdiff_t>(max_field)) {
+                file.write(chunk.get(), out - chunk.get());
+                out = chunk.get();
+            }
+            out = std::to_chars(out, chunk_end, item).ptr;
+            *out++ = ' ';
+        }
+        *out++ = '\n';
+        file.write(chunk.get(), out - chunk.get());
+    } else {
+        file << capacity_ << " " << count << " " << head_slot() << " " << tail_slot() << "\n";
+        for (size_type i = 0; i < count; ++i) {
+            file << buffer_[slot_index(tail_ + i)] << " ";
+        }
+        file << "\n";
+    }
+    if (!file) {
+        throw std::runtime_error("Error writing to file: " + filename);
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+void CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::loadFromTextFile(const std::string& filename) {
+    if constexpr (fast_text) {
+        std::ifstream file(filename, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw std::runtime_error("Cannot open file for reading: " + filename);
+        }
+        std::string contents(static_cast<size_type>(file.tellg()), '\0');
+        file.seekg(0);
+        if (!file.read(contents.data(), static_cast<std::streamsize>(contents.size()))) {
+            throw std::runtime_error("Error reading from file: " + filename);
+        }
+
+        const char* first = contents.data();
+        const char* const last = first + contents.size();
+        const auto parse = [&first, last, &filename](auto& value) {
+            while (first != last && std::isspace(static_cast<unsigned char>(*first))) {
+                ++first;
+            }
+            const auto result = std::from_chars(first, last, value);
+            if (result.ec != std::errc()) {
+                throw std::runtime_error("Error reading from file: " + filename);
+            }
+            first = result.ptr;
+        };
+
+        size_type new_capacity, new_size, new_head, new_tail;
+        parse(new_capacity);
+        parse(new_size);
+        parse(new_head);
+        parse(new_tail);
+        if (new_capacity == 0 || new_size > new_capacity || new_tail >= new_capacity) {
+            throw std::runtime_error("Invalid buffer file: " + filename);
+        }
+
+        reset_storage(new_capacity, new_tail);
+        for (size_type i = 0; i < new_size; ++i) {
+            T element;
+            parse(element);
+            push(element);
+        }
+        return;
+    }
+
+    std::ifstream file(filename);
+    if (!file) {
+        throw std::runtime_error("Cannot open file for reading: " + filename);
+    }
+
+    size_type new_capacity, new_size, new_head, new_tail;
+    file >> new_capacity >> new_size >> new_head >> new_tail;
+    if (!file || new_capacity == 0 || new_size > new_capacity || new_tail >= new_capacity) {
+        throw std::runtime_error("Invalid buffer file: " + filename);
+    }
+
+    reset_storage(new_capacity, new_tail);
+
+    for (size_type i = 0; i < new_size; ++i) {
+        T element;
+        file >> element;
+        push(std::move(element));
+    }
+
+    if (!file) {
+        throw std::runtime_error("Error reading from file: " + filename);
+    }
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+template<typename ValueType>
+class CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::basic_iterator {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<ValueType>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType*;
+    using reference = ValueType&;
+
+    basic_iterator() noexcept
+            : first_(nullptr), first_size_(0), second_(nullptr), size_(0), pos_(0) {}
+
+    basic_iterator(pointer first, size_type first_size, pointer second, size_type size, size_type pos) noexcept
+            : first_(first), first_size_(first_size), second_(second), size_(size), pos_(pos) {}
+
+    template<typename OtherValueType,
+             typename = std::enable_if_t<std::is_convertible_v<OtherValueType*, ValueType*>>>
+    basic_iterator(const basic_iterator<OtherValueType>& other) noexcept
+            : first_(other.first_), first_size_(other.first_size_), second_(other.second_), size_(other.size_)
+            , pos_(other.pos_) {}
+
+    reference operator*() const noexcept {
+        return pos_ < first_size_ ? first_[pos_] : second_[pos_ - first_size_];
+    }
+
+    pointer operator->() const noexcept {
+        return &**this;
+    }
+
+    reference operator[](difference_type n) const noexcept {
+        return *(*this + n);
+    }
+
+    size_type contiguous_size() const noexcept {
+        if (pos_ < first_size_) {
+            return first_size_ - pos_;
+        }
+        return pos_ < size_ ? size_ - pos_ : 0;
+    }
+
+    basic_iterator& operator++() noexcept {
+        ++pos_;
+        return *this;
+    }
+
+    basic_iterator operator++(int) noexcept {
+        basic_iterator temp = *this;
+        ++pos_;
+        return temp;
+    }
+
+    basic_iterator& operator--() noexcept {
+        --pos_;
+        return *this;
+    }
+
+    basic_iterator operator--(int) noexcept {
+        basic_iterator temp = *this;
+        --pos_;
+        return temp;
+    }
+
+    basic_iterator& operator+=(difference_type n) noexcept {
+        pos_ += n;
+        return *this;
+    }
+
+    basic_iterator& operator-=(difference_type n) noexcept {
+        pos_ -= n;
+        return *this;
+    }
+
+    friend basic_iterator operator+(basic_iterator it, difference_type n) noexcept {
+        return it += n;
+    }
+
+    friend basic_iterator operator+(difference_type n, basic_iterator it) noexcept {
+        return it += n;
+    }
+
+    friend basic_iterator operator-(basic_iterator it, difference_type n) noexcept {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_);
+    }
+
+    friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.first_ == rhs.first_ && lhs.pos_ == rhs.pos_;
+    }
+
+    friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.pos_ < rhs.pos_;
+    }
+
+    friend bool operator>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return !(lhs < rhs);
+    }
+
+private:
+    template<typename>
+    friend class basic_iterator;
+
+    pointer first_;
+    size_type first_size_;
+    pointer second_;
+    size_type size_;
+    size_type pos_;
+};
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::iterator
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::begin() noexcept {
+    const auto [first, first_size] = array_one();
+    return iterator(first, first_size, buffer_, size(), 0);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::const_iterator
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::begin() const noexcept {
+    const auto [first, first_size] = array_one();
+    return const_iterator(first, first_size, buffer_, size(), 0);
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::const_iterator
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::cbegin() const noexcept {
+    return begin();
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::iterator
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::end() noexcept {
+    return begin() + static_cast<std::ptrdiff_t>(size());
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::const_iterator
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::end() const noexcept {
+    return begin() + static_cast<std::ptrdiff_t>(size());
+}
+
+template<typename T, typename CapacityPolicy, typename Allocator, typename OverflowPolicy>
+typename CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::const_iterator
+CircularBuffer<T, CapacityPolicy, Allocator, OverflowPolicy>::cend() const noexcept {
+    return end();
+}
+
+#ifdef __cpp_lib_memory_resource
+namespace pmr {
+template<typename T, typename CapacityPolicy = ModuloCapacity, typename OverflowPolicy = OverwriteOldest>
+using CircularBuffer = ::CircularBuffer<T, CapacityPolicy, std::pmr::polymorphic_allocator<T>, OverflowPolicy>;
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+#ifndef CRC32_HPP
+#define CRC32_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+class Crc32 {
+public:
+    static std::uint32_t update(std::uint32_t crc, const void* data, std::size_t size) noexcept;
+    static std::uint32_t compute(const void* data, std::size_t size) noexcept;
+
+private:
+    using Table = std::array<std::array<std::uint32_t, 256>, 8>;
+
+    static constexpr Table make_table() noexcept;
+};
+
+
+constexpr Crc32::Table Crc32::make_table() noexcept {
+    Table table{};
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        std::uint32_t value = i;
+        for (int bit = 0; bit < 8; ++bit) {
+            value = (value & 1) ? (value >> 1) ^ 0xEDB88320u : value >> 1;
+        }
+        table[0][i] = value;
+    }
+    for (std::uint32_t i = 0; i < 256; ++i) {
+        for (std::size_t slice = 1; slice < 8; ++slice) {
+            const std::uint32_t previous = table[slice - 1][i];
+            table[slice][i] = (previous >> 8) ^ table[0][previous & 0xFFu];
+        }
+    }
+    return table;
+}
+
+inline std::uint32_t Crc32::update(std::uint32_t crc, const void* data, std::size_t size) noexcept {
+    static constexpr Table table = make_table();
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    crc = ~crc;
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    for (; size >= 8; size -= 8, bytes += 8) {
+        std::uint32_t low;
+        std::uint32_t high;
+        std::memcpy(&low, bytes, sizeof(low));
+        std::memcpy(&high, bytes + 4, sizeof(high));
+        low ^= crc;
+        crc = table[7][low & 0xFFu] ^ table[6][(low >> 8) & 0xFFu] ^
+              table[5][(low >> 16) & 0xFFu] ^ table[4][low >> 24] ^
+              table[3][high & 0xFFu] ^ table[2][(high >> 8) & 0xFFu] ^
+              table[1][(high >> 16) & 0xFFu] ^ table[0][high >> 24];
+    }
+#endif
+
+    for (; size > 0; --size, ++bytes) {
+        crc = table[0][(crc ^ *bytes) & 0xFFu] ^ (crc >> 8);
+    }
+    return ~crc;
+}
+
+inline std::uint32_t Crc32::compute(const void* data, std::size_t size) noexcept {
+    return update(0, data, size);
+}
+
+#endif
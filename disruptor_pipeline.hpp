@@ -0,0 +1,343 @@
+#ifndef DISRUPTOR_PIPELINE_HPP
+#define DISRUPTOR_PIPELINE_HPP
+
+#include "circular_buffer.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+
+struct BusySpinWait {
+    std::uint64_t wait(const std::atomic<std::uint64_t>& sequence, std::uint64_t needed,
+                       const std::atomic<bool>& finished) noexcept;
+    void notify() noexcept {}
+};
+
+struct YieldingWait {
+    static constexpr int spin_limit = 100;
+
+    std::uint64_t wait(const std::atomic<std::uint64_t>& sequence, std::uint64_t needed,
+                       const std::atomic<bool>& finished) noexcept;
+    void notify() noexcept {}
+};
+
+class BlockingWait {
+public:
+    std::uint64_t wait(const std::atomic<std::uint64_t>& sequence, std::uint64_t needed,
+                       const std::atomic<bool>& finished) noexcept;
+    void notify() noexcept;
+
+private:
+    static constexpr std::size_t cache_line_size = 64;
+
+    alignas(cache_line_size) std::atomic<std::uint32_t> epoch_{0};
+    std::atomic<std::uint32_t> waiters_{0};
+};
+
+template<typename T, std::size_t Stages, typename WaitStrategy = YieldingWait>
+class DisruptorPipeline {
+    static_assert(Stages > 0, "DisruptorPipeline requires at least one stage");
+    static_assert(std::is_default_constructible_v<T>, "DisruptorPipeline preallocates its events");
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using size_type = std::size_t;
+
+    explicit DisruptorPipeline(size_type capacity);
+
+    DisruptorPipeline(const DisruptorPipeline&) = delete;
+    DisruptorPipeline& operator=(const DisruptorPipeline&) = delete;
+
+    template<typename Function>
+    void publish(Function fill);
+    template<typename Function>
+    [[nodiscard]] bool try_publish(Function fill);
+    template<typename Function>
+    size_type publish_batch(size_type count, Function fill);
+    void close() noexcept;
+
+    template<typename Handler>
+    size_type process(size_type stage, Handler handler, size_type max_batch = std::numeric_limits<size_type>::max());
+    template<typename Handler>
+    size_type try_process(size_type stage, Handler handler,
+                          size_type max_batch = std::numeric_limits<size_type>::max());
+    template<typename Handler>
+    size_type run(size_type stage, Handler handler, size_type max_batch = std::numeric_limits<size_type>::max());
+
+    [[nodiscard]] std::uint64_t published() const noexcept;
+    [[nodiscard]] std::uint64_t sequence(size_type stage) const;
+    [[nodiscard]] bool finished(size_type stage) const;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] static constexpr size_type stage_count() noexcept;
+
+private:
+    static constexpr size_type cache_line_size = 64;
+
+    struct alignas(cache_line_size) Sequence {
+        std::atomic<std::uint64_t> value{0};
+        std::atomic<bool> finished{false};
+    };
+
+    std::unique_ptr<T[]> events_;
+    size_type capacity_;
+    size_type mask_;
+    std::array<Sequence, Stages + 1> sequences_;
+    WaitStrategy wait_;
+
+    alignas(cache_line_size) std::uint64_t cached_consumed_;
+
+    T& event(std::uint64_t position) const noexcept;
+    std::uint64_t claim(size_type count);
+    void commit(std::uint64_t end) noexcept;
+    template<typename Handler>
+    size_type consume(size_type stage, Handler& handler, size_type max_batch, bool block);
+    void check_stage(size_type stage) const;
+};
+
+
+inline std::uint64_t BusySpinWait::wait(const std::atomic<std::uint64_t>& sequence, std::uint64_t needed,
+                                        const std::atomic<bool>& finished) noexcept {
+    std::uint64_t value = sequence.load(std::memory_order_acquire);
+    while (value < needed && !finished.load(std::memory_order_acquire)) {
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+        value = sequence.load(std::memory_order_acquire);
+    }
+    return value;
+}
+
+inline std::uint64_t YieldingWait::wait(const std::atomic<std::uint64_t>& sequence, std::uint64_t needed,
+                                        const std::atomic<bool>& finished) noexcept {
+    std::uint64_t value = sequence.load(std::memory_order_acquire);
+    for (int spins = 0; value < needed && !finished.load(std::memory_order_acquire); ++spins) {
+        if (spins >= spin_limit) {
+            std::this_thread::yield();
+        }
+        value = sequence.load(std::memory_order_acquire);
+    }
+    return value;
+}
+
+inline std::uint64_t BlockingWait::wait(const std::atomic<std::uint64_t>& sequence, std::uint64_t needed,
+                                        const std::atomic<bool>& finished) noexcept {
+    for (;;) {
+        std::uint64_t value = sequence.load(std::memory_order_acquire);
+        if (value >= needed || finished.load(std::memory_order_acquire)) {
+            return value;
+        }
+        const std::uint32_t epoch = epoch_.load(std::memory_order_acquire);
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        value = sequence.load(std::memory_order_seq_cst);
+        if (value >= needed || finished.load(std::memory_order_seq_cst)) {
+            return value;
+        }
+        epoch_.wait(epoch, std::memory_order_acquire);
+    }
+}
+
+inline void BlockingWait::notify() noexcept {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiters_.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    if (waiters_.exchange(0, std::memory_order_acq_rel) != 0) {
+        epoch_.fetch_add(1, std::memory_order_release);
+        epoch_.notify_all();
+    }
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+DisruptorPipeline<T, Stages, WaitStrategy>::DisruptorPipeline(size_type capacity)
+        : capacity_(capacity == 0 ? 0 : PowerOfTwoCapacity::round_up(capacity))
+        , mask_(capacity_ - 1)
+        , cached_consumed_(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Capacity must be greater than 0");
+    }
+    events_ = std::make_unique<T[]>(capacity_);
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+T& DisruptorPipeline<T, Stages, WaitStrategy>::event(std::uint64_t position) const noexcept {
+    return events_[static_cast<size_type>(position) & mask_];
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+void DisruptorPipeline<T, Stages, WaitStrategy>::check_stage(size_type stage) const {
+    if (stage >= Stages) {
+        throw std::out_of_range("Stage out of range");
+    }
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+std::uint64_t DisruptorPipeline<T, Stages, WaitStrategy>::claim(size_type count) {
+    const std::uint64_t head = sequences_[0].value.load(std::memory_order_relaxed);
+    const std::uint64_t needed = head + count - capacity_;
+    if (head + count > cached_consumed_ + capacity_) {
+        Sequence& last = sequences_[Stages];
+        cached_consumed_ = wait_.wait(last.value, needed, last.finished);
+        if (cached_consumed_ < needed) {
+            throw std::runtime_error("Pipeline stages have finished");
+        }
+    }
+    return head;
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+void DisruptorPipeline<T, Stages, WaitStrategy>::commit(std::uint64_t end) noexcept {
+    sequences_[0].value.store(end, std::memory_order_release);
+    wait_.notify();
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+template<typename Function>
+void DisruptorPipeline<T, Stages, WaitStrategy>::publish(Function fill) {
+    const std::uint64_t position = claim(1);
+    fill(event(position));
+    commit(position + 1);
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+template<typename Function>
+bool DisruptorPipeline<T, Stages, WaitStrategy>::try_publish(Function fill) {
+    const std::uint64_t position = sequences_[0].value.load(std::memory_order_relaxed);
+    if (position + 1 > cached_consumed_ + capacity_) {
+        cached_consumed_ = sequences_[Stages].value.load(std::memory_order_acquire);
+        if (position + 1 > cached_consumed_ + capacity_) {
+            return false;
+        }
+    }
+    fill(event(position));
+    commit(position + 1);
+    return true;
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+template<typename Function>
+typename DisruptorPipeline<T, Stages, WaitStrategy>::size_type
+DisruptorPipeline<T, Stages, WaitStrategy>::publish_batch(size_type count, Function fill) {
+    count = std::min(count, capacity_);
+    if (count == 0) {
+        return 0;
+    }
+    const std::uint64_t first = claim(count);
+    for (size_type i = 0; i < count; ++i) {
+        fill(event(first + i), i);
+    }
+    commit(first + count);
+    return count;
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+void DisruptorPipeline<T, Stages, WaitStrategy>::close() noexcept {
+    sequences_[0].finished.store(true, std::memory_order_release);
+    wait_.notify();
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+template<typename Handler>
+typename DisruptorPipeline<T, Stages, WaitStrategy>::size_type
+DisruptorPipeline<T, Stages, WaitStrategy>::consume(size_type stage, Handler& handler, size_type max_batch,
+                                                    bool block) {
+    check_stage(stage);
+    Sequence& upstream = sequences_[stage];
+    Sequence& own = sequences_[stage + 1];
+    const std::uint64_t next = own.value.load(std::memory_order_relaxed);
+    std::uint64_t available = upstream.value.load(std::memory_order_acquire);
+    if (available == next) {
+        if (upstream.finished.load(std::memory_order_acquire)) {
+            available = upstream.value.load(std::memory_order_acquire);
+            if (available == next) {
+                own.finished.store(true, std::memory_order_release);
+                wait_.notify();
+                return 0;
+            }
+        } else if (!block) {
+            return 0;
+        } else {
+            available = wait_.wait(upstream.value, next + 1, upstream.finished);
+            if (available == next) {
+                return consume(stage, handler, max_batch, false);
+            }
+        }
+    }
+
+    const std::uint64_t end = next + std::min<std::uint64_t>(available - next, max_batch);
+    for (std::uint64_t position = next; position < end; ++position) {
+        if constexpr (std::is_invocable_v<Handler&, T&, std::uint64_t>) {
+            handler(event(position), position);
+        } else {
+            handler(event(position));
+        }
+    }
+    own.value.store(end, std::memory_order_release);
+    wait_.notify();
+    return static_cast<size_type>(end - next);
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+template<typename Handler>
+typename DisruptorPipeline<T, Stages, WaitStrategy>::size_type
+DisruptorPipeline<T, Stages, WaitStrategy>::process(size_type stage, Handler handler, size_type max_batch) {
+    return consume(stage, handler, max_batch, true);
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+template<typename Handler>
+typename DisruptorPipeline<T, Stages, WaitStrategy>::size_type
+DisruptorPipeline<T, Stages, WaitStrategy>::try_process(size_type stage, Handler handler, size_type max_batch) {
+    return consume(stage, handler, max_batch, false);
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+template<typename Handler>
+typename DisruptorPipeline<T, Stages, WaitStrategy>::size_type
+DisruptorPipeline<T, Stages, WaitStrategy>::run(size_type stage, Handler handler, size_type max_batch) {
+    size_type total = 0;
+    while (const size_type count = consume(stage, handler, max_batch, true)) {
+        total += count;
+    }
+    return total;
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+std::uint64_t DisruptorPipeline<T, Stages, WaitStrategy>::published() const noexcept {
+    return sequences_[0].value.load(std::memory_order_acquire);
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+std::uint64_t DisruptorPipeline<T, Stages, WaitStrategy>::sequence(size_type stage) const {
+    check_stage(stage);
+    return sequences_[stage + 1].value.load(std::memory_order_acquire);
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+bool DisruptorPipeline<T, Stages, WaitStrategy>::finished(size_type stage) const {
+    check_stage(stage);
+    return sequences_[stage + 1].finished.load(std::memory_order_acquire);
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+typename DisruptorPipeline<T, Stages, WaitStrategy>::size_type
+DisruptorPipeline<T, Stages, WaitStrategy>::capacity() const noexcept {
+    return capacity_;
+}
+
+template<typename T, std::size_t Stages, typename WaitStrategy>
+constexpr typename DisruptorPipeline<T, Stages, WaitStrategy>::size_type
+DisruptorPipeline<T, Stages, WaitStrategy>::stage_count() noexcept {
+    return Stages;
+}
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef HUGE_PAGE_RESOURCE_HPP
+#define HUGE_PAGE_RESOURCE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+class HugePageResource : public std::pmr::memory_resource {
+public:
+    static constexpr std::size_t huge_page_size = std::size_t(2) << 20;
+
+    explicit HugePageResource(int numa_node = -1) noexcept;
+
+    [[nodiscard]] int numa_node() const noexcept;
+
+    static std::size_t page_size() noexcept;
+    static std::size_t mapping_size(std::size_t bytes) noexcept;
+
+private:
+    static constexpr int mpol_preferred = 1;
+
+    int numa_node_;
+
+    void* map(std::size_t size) const;
+    void bind(void* address, std::size_t size) const noexcept;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+    void do_deallocate(void* address, std::size_t bytes, std::size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+};
+
+
+inline HugePageResource::HugePageResource(int numa_node) noexcept
+        : numa_node_(numa_node) {
+}
+
+inline int HugePageResource::numa_node() const noexcept {
+    return numa_node_;
+}
+
+inline std::size_t HugePageResource::page_size() noexcept {
+    static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+}
+
+inline std::size_t HugePageResource::mapping_size(std::size_t bytes) noexcept {
+    const std::size_t granularity = bytes >= huge_page_size ? huge_page_size : page_size();
+    return (bytes + granularity - 1) / granularity * granularity + (bytes == 0 ? granularity : 0);
+}
+
+inline void* HugePageResource::map(std::size_t size) const {
+    if (size % huge_page_size != 0) {
+        void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (address == MAP_FAILED) {
+            throw std::bad_alloc();
+        }
+        return address;
+    }
+
+#ifdef MAP_HUGETLB
+    void* address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                           MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (address != MAP_FAILED) {
+        return address;
+    }
+#endif
+
+    void* reserved = ::mmap(nullptr, size + huge_page_size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+    const auto base = reinterpret_cast<std::uintptr_t>(reserved);
+    const auto aligned = (base + huge_page_size - 1) / huge_page_size * huge_page_size;
+    if (aligned != base) {
+        ::munmap(reserved, aligned - base);
+    }
+    if (const std::size_t trailing = huge_page_size - (aligned - base); trailing != 0) {
+        ::munmap(reinterpret_cast<void*>(aligned + size), trailing);
+    }
+#ifdef MADV_HUGEPAGE
+    ::madvise(reinterpret_cast<void*>(aligned), size, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<void*>(aligned);
+}
+
+inline void HugePageResource::bind(void* address, std::size_t size) const noexcept {
+#ifdef SYS_mbind
+    if (numa_node_ < 0) {
+        return;
+    }
+    constexpr std::size_t bits = sizeof(unsigned long) * 8;
+    const auto node = static_cast<std::size_t>(numa_node_);
+    std::vector<unsigned long> mask(node / bits + 1);
+    mask[node / bits] = 1ul << (node % bits);
+    ::syscall(SYS_mbind, address, size, mpol_preferred, mask.data(), mask.size() * bits + 1, 0u);
+#else
+    (void)address;
+    (void)size;
+#endif
+}
+
+inline void* HugePageResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+    const std::size_t size = mapping_size(bytes);
+    if (alignment > (size % huge_page_size == 0 ? huge_page_size : page_size())) {
+        throw std::bad_alloc();
+    }
+    void* address = map(size);
+    bind(address, size);
+    return address;
+}
+
+inline void HugePageResource::do_deallocate(void* address, std::size_t bytes, std::size_t) {
+    ::munmap(address, mapping_size(bytes));
+}
+
+inline bool HugePageResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept {
+    return this == &other;
+}
+
+#endif
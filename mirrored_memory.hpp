@@ -0,0 +1,78 @@
+#ifndef MIRRORED_MEMORY_HPP
+#define MIRRORED_MEMORY_HPP
+
+#include <cstddef>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+class MirroredMemory {
+public:
+    static std::size_t page_size() noexcept;
+    static void* allocate(std::size_t bytes) noexcept;
+    static void deallocate(void* address, std::size_t bytes) noexcept;
+};
+
+
+inline std::size_t MirroredMemory::page_size() noexcept {
+#if defined(__linux__)
+    static const std::size_t size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+inline void* MirroredMemory::allocate(std::size_t bytes) noexcept {
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+    if (bytes == 0 || bytes % page_size() != 0) {
+        return nullptr;
+    }
+
+    const int fd = ::memfd_create("circular_buffer", MFD_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+    if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    void* reserved = ::mmap(nullptr, bytes * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (reserved == MAP_FAILED) {
+        ::close(fd);
+        return nullptr;
+    }
+
+    auto* base = static_cast<char*>(reserved);
+    void* first = ::mmap(base, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    void* second = first == MAP_FAILED
+                   ? MAP_FAILED
+                   : ::mmap(base + bytes, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0);
+    ::close(fd);
+
+    if (first == MAP_FAILED || second == MAP_FAILED) {
+        ::munmap(reserved, bytes * 2);
+        return nullptr;
+    }
+    return reserved;
+#else
+    (void)bytes;
+    return nullptr;
+#endif
+}
+
+inline void MirroredMemory::deallocate(void* address, std::size_t bytes) noexcept {
+#if defined(__linux__)
+    if (address != nullptr) {
+        ::munmap(address, bytes * 2);
+    }
+#else
+    (void)address;
+    (void)bytes;
+#endif
+}
+
+#endif
@@ -0,0 +1,204 @@
+#ifndef MPMC_CIRCULAR_BUFFER_HPP
+#define MPMC_CIRCULAR_BUFFER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template<typename T>
+class MpmcCircularBuffer {
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using size_type = std::size_t;
+
+    explicit MpmcCircularBuffer(size_type capacity);
+
+    MpmcCircularBuffer(const MpmcCircularBuffer&) = delete;
+    MpmcCircularBuffer& operator=(const MpmcCircularBuffer&) = delete;
+    ~MpmcCircularBuffer();
+
+    [[nodiscard]] bool try_push(const_reference value);
+    [[nodiscard]] bool try_push(T&& value);
+    template<typename... Args>
+    [[nodiscard]] bool try_emplace(Args&&... args);
+    [[nodiscard]] bool try_pop(T& value);
+
+    template<typename InputIt>
+    size_type try_push_batch(InputIt first, size_type count);
+    template<typename OutputIt>
+    size_type try_pop_batch(OutputIt out, size_type max_count);
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+
+private:
+    static constexpr size_type cache_line_size = 64;
+
+    struct Slot {
+        std::atomic<size_type> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        pointer value() noexcept {
+            return std::launder(reinterpret_cast<pointer>(storage));
+        }
+    };
+
+    std::unique_ptr<Slot[]> slots_;
+    size_type capacity_;
+
+    alignas(cache_line_size) std::atomic<size_type> head_;
+    alignas(cache_line_size) std::atomic<size_type> tail_;
+
+    Slot& slot(size_type position) const noexcept;
+    size_type turn(size_type position) const noexcept;
+    size_type claim(std::atomic<size_type>& cursor, size_type ready_offset,
+                    size_type max_count, size_type& position) noexcept;
+};
+
+
+template<typename T>
+MpmcCircularBuffer<T>::MpmcCircularBuffer(size_type capacity)
+        : capacity_(capacity)
+        , head_(0)
+        , tail_(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Capacity must be greater than 0");
+    }
+    slots_ = std::make_unique<Slot[]>(capacity);
+    for (size_type i = 0; i < capacity; ++i) {
+        slots_[i].sequence.store(0, std::memory_order_relaxed);
+    }
+}
+
+template<typename T>
+MpmcCircularBuffer<T>::~MpmcCircularBuffer() {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        const size_type head = head_.load(std::memory_order_relaxed);
+        for (size_type position = tail_.load(std::memory_order_relaxed); position != head; ++position) {
+            std::destroy_at(slot(position).value());
+        }
+    }
+}
+
+template<typename T>
+typename MpmcCircularBuffer<T>::Slot& MpmcCircularBuffer<T>::slot(size_type position) const noexcept {
+    return slots_[position % capacity_];
+}
+
+template<typename T>
+typename MpmcCircularBuffer<T>::size_type MpmcCircularBuffer<T>::turn(size_type position) const noexcept {
+    return position / capacity_ * 2;
+}
+
+template<typename T>
+typename MpmcCircularBuffer<T>::size_type
+MpmcCircularBuffer<T>::claim(std::atomic<size_type>& cursor, size_type ready_offset,
+                             size_type max_count, size_type& position) noexcept {
+    position = cursor.load(std::memory_order_relaxed);
+    for (;;) {
+        size_type count = 0;
+        while (count < max_count &&
+               slot(position + count).sequence.load(std::memory_order_acquire) ==
+               turn(position + count) + ready_offset) {
+            ++count;
+        }
+
+        if (count == 0) {
+            const size_type sequence = slot(position).sequence.load(std::memory_order_acquire);
+            if (static_cast<std::ptrdiff_t>(sequence - (turn(position) + ready_offset)) < 0) {
+                return 0;
+            }
+            position = cursor.load(std::memory_order_relaxed);
+            continue;
+        }
+
+        if (cursor.compare_exchange_weak(position, position + count, std::memory_order_relaxed)) {
+            return count;
+        }
+    }
+}
+
+template<typename T>
+bool MpmcCircularBuffer<T>::try_push(const_reference value) {
+    return try_emplace(value);
+}
+
+template<typename T>
+bool MpmcCircularBuffer<T>::try_push(T&& value) {
+    return try_emplace(std::move(value));
+}
+
+template<typename T>
+template<typename... Args>
+bool MpmcCircularBuffer<T>::try_emplace(Args&&... args) {
+    size_type position;
+    if (claim(head_, 0, 1, position) == 0) {
+        return false;
+    }
+    Slot& target = slot(position);
+    ::new (static_cast<void*>(target.storage)) T(std::forward<Args>(args)...);
+    target.sequence.store(turn(position) + 1, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+bool MpmcCircularBuffer<T>::try_pop(T& value) {
+    return try_pop_batch(&value, 1) == 1;
+}
+
+template<typename T>
+template<typename InputIt>
+typename MpmcCircularBuffer<T>::size_type
+MpmcCircularBuffer<T>::try_push_batch(InputIt first, size_type count) {
+    size_type position;
+    const size_type claimed = claim(head_, 0, count, position);
+    for (size_type i = 0; i < claimed; ++i, ++first) {
+        Slot& target = slot(position + i);
+        ::new (static_cast<void*>(target.storage)) T(*first);
+        target.sequence.store(turn(position + i) + 1, std::memory_order_release);
+    }
+    return claimed;
+}
+
+template<typename T>
+template<typename OutputIt>
+typename MpmcCircularBuffer<T>::size_type
+MpmcCircularBuffer<T>::try_pop_batch(OutputIt out, size_type max_count) {
+    size_type position;
+    const size_type claimed = claim(tail_, 1, max_count, position);
+    for (size_type i = 0; i < claimed; ++i, ++out) {
+        Slot& source = slot(position + i);
+        *out = std::move(*source.value());
+        std::destroy_at(source.value());
+        source.sequence.store(turn(position + i) + 2, std::memory_order_release);
+    }
+    return claimed;
+}
+
+template<typename T>
+bool MpmcCircularBuffer<T>::empty() const noexcept {
+    return size() == 0;
+}
+
+template<typename T>
+typename MpmcCircularBuffer<T>::size_type MpmcCircularBuffer<T>::size() const noexcept {
+    const size_type tail = tail_.load(std::memory_order_acquire);
+    const size_type head = head_.load(std::memory_order_acquire);
+    return head > tail ? std::min(head - tail, capacity_) : 0;
+}
+
+template<typename T>
+typename MpmcCircularBuffer<T>::size_type MpmcCircularBuffer<T>::capacity() const noexcept {
+    return capacity_;
+}
+
+#endif
@@ -0,0 +1,369 @@
+#ifndef PERSISTENT_CIRCULAR_BUFFER_HPP
+#define PERSISTENT_CIRCULAR_BUFFER_HPP
+
+#include "crc32.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+template<typename T>
+class PersistentCircularBuffer {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "PersistentCircularBuffer requires a trivially copyable element type");
+
+public:
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using array_range = std::pair<pointer, size_type>;
+    using const_array_range = std::pair<const_pointer, size_type>;
+
+    PersistentCircularBuffer(const std::string& filename, size_type capacity);
+
+    PersistentCircularBuffer(const PersistentCircularBuffer&) = delete;
+    PersistentCircularBuffer& operator=(const PersistentCircularBuffer&) = delete;
+    ~PersistentCircularBuffer();
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+    reference operator[](size_type index);
+    const_reference operator[](size_type index) const;
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] bool full() const noexcept;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] std::uint64_t generation() const noexcept;
+
+    array_range array_one() noexcept;
+    const_array_range array_one() const noexcept;
+    array_range array_two() noexcept;
+    const_array_range array_two() const noexcept;
+
+    void push(const_reference value);
+    void pop();
+    void clear();
+    void sync();
+
+private:
+    static constexpr std::uint64_t magic = 0x4642554652494350ull;
+    static constexpr std::uint32_t version = 1;
+
+    struct Record {
+        std::uint64_t head;
+        std::uint64_t tail;
+        std::uint64_t generation;
+        std::uint32_t checksum;
+        std::uint32_t reserved;
+    };
+
+    struct Header {
+        std::uint64_t magic;
+        std::uint32_t version;
+        std::uint32_t element_size;
+        std::uint64_t capacity;
+        Record records[2];
+    };
+
+    int fd_;
+    void* mapping_;
+    size_type mapping_size_;
+    size_type data_offset_;
+    Header* header_;
+    pointer buffer_;
+    size_type capacity_;
+    std::uint64_t head_;
+    std::uint64_t tail_;
+    std::uint64_t generation_;
+    std::uint32_t header_checksum_;
+
+    std::uint32_t record_checksum(const Record& record) const noexcept;
+    bool record_valid(const Record& record) const noexcept;
+    void commit(std::uint64_t head, std::uint64_t tail) noexcept;
+    size_type slot_index(std::uint64_t position) const noexcept;
+    void release() noexcept;
+};
+
+
+template<typename T>
+PersistentCircularBuffer<T>::PersistentCircularBuffer(const std::string& filename, size_type capacity)
+        : fd_(-1)
+        , mapping_(MAP_FAILED)
+        , mapping_size_(0)
+        , data_offset_(0)
+        , header_(nullptr)
+        , buffer_(nullptr)
+        , capacity_(capacity)
+        , head_(0)
+        , tail_(0)
+        , generation_(0)
+        , header_checksum_(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Capacity must be greater than 0");
+    }
+
+    fd_ = ::open(filename.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) {
+        throw std::runtime_error("Cannot open file: " + filename);
+    }
+
+    struct stat info {};
+    if (::fstat(fd_, &info) != 0) {
+        release();
+        throw std::runtime_error("Cannot stat file: " + filename);
+    }
+
+    const auto page = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+    data_offset_ = (sizeof(Header) + page - 1) / page * page;
+    mapping_size_ = data_offset_ + capacity * sizeof(T);
+
+    const bool created = info.st_size == 0;
+    if (created && ::ftruncate(fd_, static_cast<off_t>(mapping_size_)) != 0) {
+        release();
+        throw std::runtime_error("Cannot size file: " + filename);
+    }
+    if (!created && static_cast<size_type>(info.st_size) != mapping_size_) {
+        release();
+        throw std::runtime_error("File does not match buffer capacity: " + filename);
+    }
+
+    mapping_ = ::mmap(nullptr, mapping_size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping_ == MAP_FAILED) {
+        release();
+        throw std::runtime_error("Cannot map file: " + filename);
+    }
+    header_ = static_cast<Header*>(mapping_);
+    buffer_ = reinterpret_cast<pointer>(static_cast<char*>(mapping_) + data_offset_);
+
+    if (created) {
+        header_->magic = magic;
+        header_->version = version;
+        header_->element_size = static_cast<std::uint32_t>(sizeof(T));
+        header_->capacity = capacity;
+        header_->records[1] = Record{};
+        header_checksum_ = Crc32::compute(header_, offsetof(Header, records));
+        commit(0, 0);
+        return;
+    }
+
+    if (header_->magic != magic || header_->version != version ||
+        header_->element_size != sizeof(T) || header_->capacity != capacity) {
+        release();
+        throw std::runtime_error("Incompatible buffer file: " + filename);
+    }
+
+    header_checksum_ = Crc32::compute(header_, offsetof(Header, records));
+    const Record* current = nullptr;
+    for (const Record& record : header_->records) {
+        if (record_valid(record) && (current == nullptr || record.generation > current->generation)) {
+            current = &record;
+        }
+    }
+    if (current == nullptr) {
+        release();
+        throw std::runtime_error("Corrupted buffer file: " + filename);
+    }
+    head_ = current->head;
+    tail_ = current->tail;
+    generation_ = current->generation;
+}
+
+template<typename T>
+PersistentCircularBuffer<T>::~PersistentCircularBuffer() {
+    release();
+}
+
+template<typename T>
+void PersistentCircularBuffer<T>::release() noexcept {
+    if (mapping_ != MAP_FAILED) {
+        ::munmap(mapping_, mapping_size_);
+        mapping_ = MAP_FAILED;
+    }
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+}
+
+template<typename T>
+std::uint32_t PersistentCircularBuffer<T>::record_checksum(const Record& record) const noexcept {
+    std::uint32_t crc = Crc32::update(header_checksum_, &record.head, sizeof(record.head));
+    crc = Crc32::update(crc, &record.tail, sizeof(record.tail));
+    return Crc32::update(crc, &record.generation, sizeof(record.generation));
+}
+
+template<typename T>
+bool PersistentCircularBuffer<T>::record_valid(const Record& record) const noexcept {
+    return record.checksum == record_checksum(record) &&
+           record.tail <= record.head && record.head - record.tail <= capacity_;
+}
+
+template<typename T>
+void PersistentCircularBuffer<T>::commit(std::uint64_t head, std::uint64_t tail) noexcept {
+    const std::uint64_t generation = generation_ + 1;
+    Record& record = header_->records[generation & 1];
+
+    record.checksum = ~record.checksum;
+    std::atomic_thread_fence(std::memory_order_release);
+    record.head = head;
+    record.tail = tail;
+    record.generation = generation;
+    std::atomic_thread_fence(std::memory_order_release);
+    record.checksum = record_checksum(record);
+
+    head_ = head;
+    tail_ = tail;
+    generation_ = generation;
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::size_type
+PersistentCircularBuffer<T>::slot_index(std::uint64_t position) const noexcept {
+    return static_cast<size_type>(position % capacity_);
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::reference PersistentCircularBuffer<T>::front() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return buffer_[slot_index(tail_)];
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::const_reference PersistentCircularBuffer<T>::front() const {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return buffer_[slot_index(tail_)];
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::reference PersistentCircularBuffer<T>::back() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return buffer_[slot_index(head_ - 1)];
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::const_reference PersistentCircularBuffer<T>::back() const {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return buffer_[slot_index(head_ - 1)];
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::reference PersistentCircularBuffer<T>::operator[](size_type index) {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return buffer_[slot_index(tail_ + index)];
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::const_reference
+PersistentCircularBuffer<T>::operator[](size_type index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return buffer_[slot_index(tail_ + index)];
+}
+
+template<typename T>
+bool PersistentCircularBuffer<T>::empty() const noexcept {
+    return head_ == tail_;
+}
+
+template<typename T>
+bool PersistentCircularBuffer<T>::full() const noexcept {
+    return size() == capacity_;
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::size_type PersistentCircularBuffer<T>::size() const noexcept {
+    return static_cast<size_type>(head_ - tail_);
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::size_type PersistentCircularBuffer<T>::capacity() const noexcept {
+    return capacity_;
+}
+
+template<typename T>
+std::uint64_t PersistentCircularBuffer<T>::generation() const noexcept {
+    return generation_;
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::array_range PersistentCircularBuffer<T>::array_one() noexcept {
+    const size_type start = slot_index(tail_);
+    return array_range(buffer_ + start, std::min(size(), capacity_ - start));
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::const_array_range PersistentCircularBuffer<T>::array_one() const noexcept {
+    const size_type start = slot_index(tail_);
+    return const_array_range(buffer_ + start, std::min(size(), capacity_ - start));
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::array_range PersistentCircularBuffer<T>::array_two() noexcept {
+    return array_range(buffer_, size() - array_one().second);
+}
+
+template<typename T>
+typename PersistentCircularBuffer<T>::const_array_range PersistentCircularBuffer<T>::array_two() const noexcept {
+    return const_array_range(buffer_, size() - array_one().second);
+}
+
+template<typename T>
+void PersistentCircularBuffer<T>::push(const_reference value) {
+    const std::uint64_t tail = full() ? tail_ + 1 : tail_;
+    if (tail != tail_) {
+        commit(head_, tail);
+    }
+    std::memcpy(buffer_ + slot_index(head_), &value, sizeof(T));
+    std::atomic_thread_fence(std::memory_order_release);
+    commit(head_ + 1, tail);
+}
+
+template<typename T>
+void PersistentCircularBuffer<T>::pop() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    commit(head_, tail_ + 1);
+}
+
+template<typename T>
+void PersistentCircularBuffer<T>::clear() {
+    commit(head_, head_);
+}
+
+template<typename T>
+void PersistentCircularBuffer<T>::sync() {
+    if (::msync(static_cast<char*>(mapping_) + data_offset_, mapping_size_ - data_offset_, MS_SYNC) != 0 ||
+        ::msync(mapping_, data_offset_, MS_SYNC) != 0) {
+        throw std::runtime_error("Cannot sync buffer file");
+    }
+}
+
+#endif
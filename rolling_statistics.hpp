@@ -0,0 +1,353 @@
+#ifndef ROLLING_STATISTICS_HPP
+#define ROLLING_STATISTICS_HPP
+
+#include "circular_buffer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <deque>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+template<typename T>
+class RollingMoments {
+public:
+    void push(const T& value) noexcept;
+    void pop(const T& value) noexcept;
+    void clear() noexcept;
+
+    [[nodiscard]] std::size_t count() const noexcept;
+    [[nodiscard]] double sum() const noexcept;
+    [[nodiscard]] double mean() const noexcept;
+    [[nodiscard]] double variance() const noexcept;
+    [[nodiscard]] double population_variance() const noexcept;
+    [[nodiscard]] double stddev() const noexcept;
+
+private:
+    std::size_t count_ = 0;
+    double sum_ = 0.0;
+    double compensation_ = 0.0;
+    double mean_ = 0.0;
+    double m2_ = 0.0;
+
+    void accumulate(double value) noexcept;
+};
+
+template<typename T>
+class RollingMinMax {
+public:
+    void push(const T& value);
+    void pop(const T& value) noexcept;
+    void clear() noexcept;
+
+    const T& min() const;
+    const T& max() const;
+
+private:
+    std::deque<T> min_;
+    std::deque<T> max_;
+};
+
+template<typename T, typename Operation>
+class RollingAggregate {
+public:
+    explicit RollingAggregate(Operation operation = Operation());
+
+    void push(const T& value);
+    void pop(const T& value);
+    void clear() noexcept;
+
+    T value() const;
+
+private:
+    Operation operation_;
+    std::vector<T> front_;
+    std::vector<T> back_;
+    std::optional<T> back_aggregate_;
+
+    void transfer();
+};
+
+template<typename T, typename... Aggregates>
+class RollingWindow {
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using buffer_type = CircularBuffer<T>;
+
+    explicit RollingWindow(size_type capacity) requires (sizeof...(Aggregates) > 0);
+    RollingWindow(size_type capacity, Aggregates... aggregates);
+
+    void push(const T& value);
+    void pop();
+    void clear();
+
+    template<typename Aggregate>
+    [[nodiscard]] const Aggregate& get() const noexcept;
+    template<std::size_t Index>
+    [[nodiscard]] const auto& get() const noexcept;
+
+    [[nodiscard]] const buffer_type& window() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] bool full() const noexcept;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+
+private:
+    buffer_type buffer_;
+    std::tuple<Aggregates...> aggregates_;
+
+    void evict_front();
+};
+
+template<typename T>
+using RollingStatistics = RollingWindow<T, RollingMoments<T>, RollingMinMax<T>>;
+
+
+template<typename T>
+void RollingMoments<T>::accumulate(double value) noexcept {
+    const double adjusted = value - compensation_;
+    const double total = sum_ + adjusted;
+    compensation_ = (total - sum_) - adjusted;
+    sum_ = total;
+}
+
+template<typename T>
+void RollingMoments<T>::push(const T& value) noexcept {
+    const auto x = static_cast<double>(value);
+    accumulate(x);
+    ++count_;
+    const double delta = x - mean_;
+    mean_ += delta / static_cast<double>(count_);
+    m2_ += delta * (x - mean_);
+}
+
+template<typename T>
+void RollingMoments<T>::pop(const T& value) noexcept {
+    if (count_ <= 1) {
+        clear();
+        return;
+    }
+    const auto x = static_cast<double>(value);
+    accumulate(-x);
+    --count_;
+    const double delta = x - mean_;
+    mean_ -= delta / static_cast<double>(count_);
+    m2_ = std::max(0.0, m2_ - delta * (x - mean_));
+}
+
+template<typename T>
+void RollingMoments<T>::clear() noexcept {
+    count_ = 0;
+    sum_ = 0.0;
+    compensation_ = 0.0;
+    mean_ = 0.0;
+    m2_ = 0.0;
+}
+
+template<typename T>
+std::size_t RollingMoments<T>::count() const noexcept {
+    return count_;
+}
+
+template<typename T>
+double RollingMoments<T>::sum() const noexcept {
+    return sum_;
+}
+
+template<typename T>
+double RollingMoments<T>::mean() const noexcept {
+    return mean_;
+}
+
+template<typename T>
+double RollingMoments<T>::variance() const noexcept {
+    return count_ > 1 ? m2_ / static_cast<double>(count_ - 1) : 0.0;
+}
+
+template<typename T>
+double RollingMoments<T>::population_variance() const noexcept {
+    return count_ > 0 ? m2_ / static_cast<double>(count_) : 0.0;
+}
+
+template<typename T>
+double RollingMoments<T>::stddev() const noexcept {
+    return std::sqrt(variance());
+}
+
+template<typename T>
+void RollingMinMax<T>::push(const T& value) {
+    while (!min_.empty() && value < min_.back()) {
+        min_.pop_back();
+    }
+    min_.push_back(value);
+    while (!max_.empty() && max_.back() < value) {
+        max_.pop_back();
+    }
+    max_.push_back(value);
+}
+
+template<typename T>
+void RollingMinMax<T>::pop(const T& value) noexcept {
+    if (!min_.empty() && !(min_.front() < value) && !(value < min_.front())) {
+        min_.pop_front();
+    }
+    if (!max_.empty() && !(max_.front() < value) && !(value < max_.front())) {
+        max_.pop_front();
+    }
+}
+
+template<typename T>
+void RollingMinMax<T>::clear() noexcept {
+    min_.clear();
+    max_.clear();
+}
+
+template<typename T>
+const T& RollingMinMax<T>::min() const {
+    if (min_.empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return min_.front();
+}
+
+template<typename T>
+const T& RollingMinMax<T>::max() const {
+    if (max_.empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return max_.front();
+}
+
+template<typename T, typename Operation>
+RollingAggregate<T, Operation>::RollingAggregate(Operation operation)
+        : operation_(std::move(operation)) {
+}
+
+template<typename T, typename Operation>
+void RollingAggregate<T, Operation>::push(const T& value) {
+    back_aggregate_ = back_aggregate_ ? operation_(*back_aggregate_, value) : value;
+    back_.push_back(value);
+}
+
+template<typename T, typename Operation>
+void RollingAggregate<T, Operation>::transfer() {
+    front_.reserve(back_.size());
+    for (auto it = back_.rbegin(); it != back_.rend(); ++it) {
+        front_.push_back(front_.empty() ? *it : operation_(*it, front_.back()));
+    }
+    back_.clear();
+    back_aggregate_.reset();
+}
+
+template<typename T, typename Operation>
+void RollingAggregate<T, Operation>::pop(const T&) {
+    if (front_.empty()) {
+        transfer();
+    }
+    if (!front_.empty()) {
+        front_.pop_back();
+    }
+}
+
+template<typename T, typename Operation>
+void RollingAggregate<T, Operation>::clear() noexcept {
+    front_.clear();
+    back_.clear();
+    back_aggregate_.reset();
+}
+
+template<typename T, typename Operation>
+T RollingAggregate<T, Operation>::value() const {
+    if (front_.empty() && !back_aggregate_) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    if (front_.empty()) {
+        return *back_aggregate_;
+    }
+    if (!back_aggregate_) {
+        return front_.back();
+    }
+    return operation_(front_.back(), *back_aggregate_);
+}
+
+template<typename T, typename... Aggregates>
+RollingWindow<T, Aggregates...>::RollingWindow(size_type capacity) requires (sizeof...(Aggregates) > 0)
+        : buffer_(capacity) {
+}
+
+template<typename T, typename... Aggregates>
+RollingWindow<T, Aggregates...>::RollingWindow(size_type capacity, Aggregates... aggregates)
+        : buffer_(capacity)
+        , aggregates_(std::move(aggregates)...) {
+}
+
+template<typename T, typename... Aggregates>
+void RollingWindow<T, Aggregates...>::evict_front() {
+    const T& oldest = buffer_.front();
+    std::apply([&oldest](auto&... aggregate) { (aggregate.pop(oldest), ...); }, aggregates_);
+}
+
+template<typename T, typename... Aggregates>
+void RollingWindow<T, Aggregates...>::push(const T& value) {
+    if (buffer_.full()) {
+        evict_front();
+    }
+    std::apply([&value](auto&... aggregate) { (aggregate.push(value), ...); }, aggregates_);
+    buffer_.push(value);
+}
+
+template<typename T, typename... Aggregates>
+void RollingWindow<T, Aggregates...>::pop() {
+    evict_front();
+    buffer_.pop();
+}
+
+template<typename T, typename... Aggregates>
+void RollingWindow<T, Aggregates...>::clear() {
+    buffer_.clear();
+    std::apply([](auto&... aggregate) { (aggregate.clear(), ...); }, aggregates_);
+}
+
+template<typename T, typename... Aggregates>
+template<typename Aggregate>
+const Aggregate& RollingWindow<T, Aggregates...>::get() const noexcept {
+    return std::get<Aggregate>(aggregates_);
+}
+
+template<typename T, typename... Aggregates>
+template<std::size_t Index>
+const auto& RollingWindow<T, Aggregates...>::get() const noexcept {
+    return std::get<Index>(aggregates_);
+}
+
+template<typename T, typename... Aggregates>
+const typename RollingWindow<T, Aggregates...>::buffer_type& RollingWindow<T, Aggregates...>::window() const noexcept {
+    return buffer_;
+}
+
+template<typename T, typename... Aggregates>
+bool RollingWindow<T, Aggregates...>::empty() const noexcept {
+    return buffer_.empty();
+}
+
+template<typename T, typename... Aggregates>
+bool RollingWindow<T, Aggregates...>::full() const noexcept {
+    return buffer_.full();
+}
+
+template<typename T, typename... Aggregates>
+typename RollingWindow<T, Aggregates...>::size_type RollingWindow<T, Aggregates...>::size() const noexcept {
+    return buffer_.size();
+}
+
+template<typename T, typename... Aggregates>
+typename RollingWindow<T, Aggregates...>::size_type RollingWindow<T, Aggregates...>::capacity() const noexcept {
+    return buffer_.capacity();
+}
+
+#endif
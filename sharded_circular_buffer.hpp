@@ -0,0 +1,256 @@
+#ifndef SHARDED_CIRCULAR_BUFFER_HPP
+#define SHARDED_CIRCULAR_BUFFER_HPP
+
+#include "circular_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+enum class ShardSelection {
+    thread,
+    cpu
+};
+
+template<typename T, typename OverflowPolicy = OverwriteOldest>
+class ShardedCircularBuffer {
+    static_assert(!OverflowPolicy::grow, "ShardedCircularBuffer requires a fixed shard capacity");
+
+public:
+    using value_type = T;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using shard_type = CircularBuffer<T, ModuloCapacity, std::allocator<T>, OverflowPolicy>;
+
+    explicit ShardedCircularBuffer(size_type shard_capacity, size_type shard_count = default_shard_count(),
+                                   ShardSelection selection = ShardSelection::thread);
+
+    ShardedCircularBuffer(const ShardedCircularBuffer&) = delete;
+    ShardedCircularBuffer& operator=(const ShardedCircularBuffer&) = delete;
+
+    bool push(const_reference value);
+    bool push(T&& value);
+    template<typename... Args>
+    bool emplace(Args&&... args);
+
+    template<typename OutputIt>
+    OutputIt drain(OutputIt out);
+    template<typename OutputIt, typename Compare = std::less<>>
+    OutputIt drain_ordered(OutputIt out, Compare compare = Compare());
+
+    [[nodiscard]] size_type size() const;
+    [[nodiscard]] size_type shard_count() const noexcept;
+    [[nodiscard]] size_type shard_capacity() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] ShardSelection selection() const noexcept;
+    [[nodiscard]] size_type current_shard() const noexcept;
+    [[nodiscard]] std::uint64_t overflow_count() const;
+    [[nodiscard]] std::uint64_t overflow_count(size_type shard) const;
+
+    static size_type default_shard_count() noexcept;
+
+private:
+    static constexpr size_type cache_line_size = 64;
+
+    struct alignas(cache_line_size) Shard {
+        explicit Shard(size_type capacity) : ring(capacity) {}
+
+        mutable std::mutex mutex;
+        shard_type ring;
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards_;
+    size_type shard_capacity_;
+    ShardSelection selection_;
+
+    static size_type thread_slot() noexcept;
+    Shard& local_shard() noexcept;
+    std::vector<std::vector<T>> collect();
+};
+
+
+template<typename T, typename OverflowPolicy>
+ShardedCircularBuffer<T, OverflowPolicy>::ShardedCircularBuffer(size_type shard_capacity, size_type shard_count,
+                                                                ShardSelection selection)
+        : shard_capacity_(shard_capacity)
+        , selection_(selection) {
+    if (shard_capacity == 0) {
+        throw std::invalid_argument("Capacity must be greater than 0");
+    }
+    if (shard_count == 0) {
+        throw std::invalid_argument("Shard count must be greater than 0");
+    }
+    shards_.reserve(shard_count);
+    for (size_type i = 0; i < shard_count; ++i) {
+        shards_.push_back(std::make_unique<Shard>(shard_capacity));
+    }
+}
+
+template<typename T, typename OverflowPolicy>
+typename ShardedCircularBuffer<T, OverflowPolicy>::size_type
+ShardedCircularBuffer<T, OverflowPolicy>::default_shard_count() noexcept {
+    return std::max<size_type>(std::thread::hardware_concurrency(), 1);
+}
+
+template<typename T, typename OverflowPolicy>
+typename ShardedCircularBuffer<T, OverflowPolicy>::size_type
+ShardedCircularBuffer<T, OverflowPolicy>::thread_slot() noexcept {
+    static std::atomic<size_type> next_slot{0};
+    thread_local const size_type slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+    return slot;
+}
+
+template<typename T, typename OverflowPolicy>
+typename ShardedCircularBuffer<T, OverflowPolicy>::size_type
+ShardedCircularBuffer<T, OverflowPolicy>::current_shard() const noexcept {
+#if defined(__linux__)
+    if (selection_ == ShardSelection::cpu) {
+        const int cpu = sched_getcpu();
+        if (cpu >= 0) {
+            return static_cast<size_type>(cpu) % shards_.size();
+        }
+    }
+#endif
+    return thread_slot() % shards_.size();
+}
+
+template<typename T, typename OverflowPolicy>
+typename ShardedCircularBuffer<T, OverflowPolicy>::Shard&
+ShardedCircularBuffer<T, OverflowPolicy>::local_shard() noexcept {
+    return *shards_[current_shard()];
+}
+
+template<typename T, typename OverflowPolicy>
+bool ShardedCircularBuffer<T, OverflowPolicy>::push(const_reference value) {
+    Shard& shard = local_shard();
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.ring.push(value);
+}
+
+template<typename T, typename OverflowPolicy>
+bool ShardedCircularBuffer<T, OverflowPolicy>::push(T&& value) {
+    Shard& shard = local_shard();
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.ring.push(std::move(value));
+}
+
+template<typename T, typename OverflowPolicy>
+template<typename... Args>
+bool ShardedCircularBuffer<T, OverflowPolicy>::emplace(Args&&... args) {
+    Shard& shard = local_shard();
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.ring.emplace(std::forward<Args>(args)...);
+}
+
+template<typename T, typename OverflowPolicy>
+std::vector<std::vector<T>> ShardedCircularBuffer<T, OverflowPolicy>::collect() {
+    std::vector<std::vector<T>> runs(shards_.size());
+    for (size_type i = 0; i < shards_.size(); ++i) {
+        std::lock_guard<std::mutex> lock(shards_[i]->mutex);
+        runs[i].reserve(shards_[i]->ring.size());
+        shards_[i]->ring.pop_into(std::back_inserter(runs[i]), shards_[i]->ring.size());
+    }
+    return runs;
+}
+
+template<typename T, typename OverflowPolicy>
+template<typename OutputIt>
+OutputIt ShardedCircularBuffer<T, OverflowPolicy>::drain(OutputIt out) {
+    for (auto& run : collect()) {
+        out = std::move(run.begin(), run.end(), out);
+    }
+    return out;
+}
+
+template<typename T, typename OverflowPolicy>
+template<typename OutputIt, typename Compare>
+OutputIt ShardedCircularBuffer<T, OverflowPolicy>::drain_ordered(OutputIt out, Compare compare) {
+    auto runs = collect();
+    using cursor = std::pair<typename std::vector<T>::iterator, typename std::vector<T>::iterator>;
+    std::vector<cursor> heap;
+    heap.reserve(runs.size());
+    for (auto& run : runs) {
+        if (!run.empty()) {
+            heap.emplace_back(run.begin(), run.end());
+        }
+    }
+    const auto later = [&compare](const cursor& lhs, const cursor& rhs) { return compare(*rhs.first, *lhs.first); };
+    std::make_heap(heap.begin(), heap.end(), later);
+    while (!heap.empty()) {
+        std::pop_heap(heap.begin(), heap.end(), later);
+        cursor& next = heap.back();
+        *out = std::move(*next.first);
+        ++out;
+        if (++next.first == next.second) {
+            heap.pop_back();
+        } else {
+            std::push_heap(heap.begin(), heap.end(), later);
+        }
+    }
+    return out;
+}
+
+template<typename T, typename OverflowPolicy>
+typename ShardedCircularBuffer<T, OverflowPolicy>::size_type ShardedCircularBuffer<T, OverflowPolicy>::size() const {
+    size_type total = 0;
+    for (const auto& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard->mutex);
+        total += shard->ring.size();
+    }
+    return total;
+}
+
+template<typename T, typename OverflowPolicy>
+typename ShardedCircularBuffer<T, OverflowPolicy>::size_type
+ShardedCircularBuffer<T, OverflowPolicy>::shard_count() const noexcept {
+    return shards_.size();
+}
+
+template<typename T, typename OverflowPolicy>
+typename ShardedCircularBuffer<T, OverflowPolicy>::size_type
+ShardedCircularBuffer<T, OverflowPolicy>::shard_capacity() const noexcept {
+    return shard_capacity_;
+}
+
+template<typename T, typename OverflowPolicy>
+typename ShardedCircularBuffer<T, OverflowPolicy>::size_type
+ShardedCircularBuffer<T, OverflowPolicy>::capacity() const noexcept {
+    return shard_capacity_ * shards_.size();
+}
+
+template<typename T, typename OverflowPolicy>
+ShardSelection ShardedCircularBuffer<T, OverflowPolicy>::selection() const noexcept {
+    return selection_;
+}
+
+template<typename T, typename OverflowPolicy>
+std::uint64_t ShardedCircularBuffer<T, OverflowPolicy>::overflow_count() const {
+    std::uint64_t total = 0;
+    for (size_type i = 0; i < shards_.size(); ++i) {
+        total += overflow_count(i);
+    }
+    return total;
+}
+
+template<typename T, typename OverflowPolicy>
+std::uint64_t ShardedCircularBuffer<T, OverflowPolicy>::overflow_count(size_type shard) const {
+    if (shard >= shards_.size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    std::lock_guard<std::mutex> lock(shards_[shard]->mutex);
+    return shards_[shard]->ring.overflow_count();
+}
+
+#endif
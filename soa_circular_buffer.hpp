@@ -0,0 +1,593 @@
+#ifndef SOA_CIRCULAR_BUFFER_HPP
+#define SOA_CIRCULAR_BUFFER_HPP
+
+#include "circular_buffer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+template<typename OverflowPolicy, typename... Ts>
+class BasicSoACircularBuffer {
+    static_assert(sizeof...(Ts) > 0, "SoACircularBuffer requires at least one column");
+    static_assert(!OverflowPolicy::grow, "SoACircularBuffer does not support growing its capacity");
+
+public:
+    using value_type = std::tuple<Ts...>;
+    using reference = std::tuple<Ts&...>;
+    using const_reference = std::tuple<const Ts&...>;
+    using size_type = std::size_t;
+    template<std::size_t I>
+    using column_type = std::tuple_element_t<I, value_type>;
+
+    template<typename E>
+    class column_view;
+    template<bool Const>
+    class basic_iterator;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    explicit BasicSoACircularBuffer(size_type capacity);
+    BasicSoACircularBuffer(const BasicSoACircularBuffer& other);
+    BasicSoACircularBuffer(BasicSoACircularBuffer&& other) noexcept;
+    BasicSoACircularBuffer& operator=(const BasicSoACircularBuffer& other);
+    BasicSoACircularBuffer& operator=(BasicSoACircularBuffer&& other) noexcept;
+    ~BasicSoACircularBuffer();
+
+    reference front();
+    const_reference front() const;
+    reference back();
+    const_reference back() const;
+    reference operator[](size_type index);
+    const_reference operator[](size_type index) const;
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] bool full() const noexcept;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] std::uint64_t overflow_count() const noexcept;
+
+    template<std::size_t I>
+    column_view<column_type<I>> column() noexcept;
+    template<std::size_t I>
+    column_view<const column_type<I>> column() const noexcept;
+
+    bool push(const Ts&... values);
+    bool push(Ts&&... values);
+    void pop();
+    size_type pop_n(size_type count);
+    void clear() noexcept;
+
+    iterator begin() noexcept;
+    const_iterator begin() const noexcept;
+    const_iterator cbegin() const noexcept;
+    iterator end() noexcept;
+    const_iterator end() const noexcept;
+    const_iterator cend() const noexcept;
+
+private:
+    using indices = std::index_sequence_for<Ts...>;
+
+    std::tuple<Ts*...> columns_;
+    size_type capacity_;
+    size_type tail_;
+    size_type size_;
+    std::uint64_t overflow_count_;
+
+    size_type slot_index(size_type position) const noexcept;
+    void allocate_columns();
+    void deallocate_columns() noexcept;
+    template<typename... Args>
+    void construct_row(size_type slot, Args&&... args);
+    template<typename... Args>
+    void assign_row(size_type slot, Args&&... args);
+    void destroy_row(size_type slot) noexcept;
+    reference row(size_type slot) noexcept;
+    const_reference row(size_type slot) const noexcept;
+    template<typename... Args>
+    bool push_row(Args&&... args);
+    void swap(BasicSoACircularBuffer& other) noexcept;
+};
+
+template<typename... Ts>
+using SoACircularBuffer = BasicSoACircularBuffer<OverwriteOldest, Ts...>;
+
+
+template<typename OverflowPolicy, typename... Ts>
+template<typename E>
+class BasicSoACircularBuffer<OverflowPolicy, Ts...>::column_view {
+public:
+    using value_type = std::remove_const_t<E>;
+    using size_type = std::size_t;
+    using array_range = std::pair<E*, size_type>;
+
+    column_view(E* data, size_type capacity, size_type tail, size_type size) noexcept
+            : data_(data), capacity_(capacity), tail_(tail), size_(size) {}
+
+    E& operator[](size_type index) const {
+        if (index >= size_) {
+            throw std::out_of_range("Index out of range");
+        }
+        const size_type slot = tail_ + index;
+        return data_[slot < capacity_ ? slot : slot - capacity_];
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    [[nodiscard]] size_type size() const noexcept {
+        return size_;
+    }
+
+    array_range array_one() const noexcept {
+        return array_range(data_ + tail_, std::min(size_, capacity_ - tail_));
+    }
+
+    array_range array_two() const noexcept {
+        return array_range(data_, size_ - array_one().second);
+    }
+
+    std::pair<std::span<E>, std::span<E>> segments() const noexcept {
+        const auto [first, first_size] = array_one();
+        const auto [second, second_size] = array_two();
+        return {std::span<E>(first, first_size), std::span<E>(second, second_size)};
+    }
+
+private:
+    E* data_;
+    size_type capacity_;
+    size_type tail_;
+    size_type size_;
+};
+
+template<typename OverflowPolicy, typename... Ts>
+template<bool Const>
+class BasicSoACircularBuffer<OverflowPolicy, Ts...>::basic_iterator {
+    using owner_type = std::conditional_t<Const, const BasicSoACircularBuffer, BasicSoACircularBuffer>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::tuple<Ts...>;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::conditional_t<Const, std::tuple<const Ts&...>, std::tuple<Ts&...>>;
+
+    basic_iterator() noexcept
+            : owner_(nullptr), pos_(0) {}
+
+    basic_iterator(owner_type* owner, size_type pos) noexcept
+            : owner_(owner), pos_(pos) {}
+
+    template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+    basic_iterator(const basic_iterator<OtherConst>& other) noexcept
+            : owner_(other.owner_), pos_(other.pos_) {}
+
+    reference operator*() const noexcept {
+        return owner_->row(owner_->slot_index(owner_->tail_ + pos_));
+    }
+
+    reference operator[](difference_type n) const noexcept {
+        return *(*this + n);
+    }
+
+    basic_iterator& operator++() noexcept {
+        ++pos_;
+        return *this;
+    }
+
+    basic_iterator operator++(int) noexcept {
+        basic_iterator temp = *this;
+        ++pos_;
+        return temp;
+    }
+
+    basic_iterator& operator--() noexcept {
+        --pos_;
+        return *this;
+    }
+
+    basic_iterator operator--(int) noexcept {
+        basic_iterator temp = *this;
+        --pos_;
+        return temp;
+    }
+
+    basic_iterator& operator+=(difference_type n) noexcept {
+        pos_ += n;
+        return *this;
+    }
+
+    basic_iterator& operator-=(difference_type n) noexcept {
+        pos_ -= n;
+        return *this;
+    }
+
+    friend basic_iterator operator+(basic_iterator it, difference_type n) noexcept {
+        return it += n;
+    }
+
+    friend basic_iterator operator+(difference_type n, basic_iterator it) noexcept {
+        return it += n;
+    }
+
+    friend basic_iterator operator-(basic_iterator it, difference_type n) noexcept {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_);
+    }
+
+    friend bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.owner_ == rhs.owner_ && lhs.pos_ == rhs.pos_;
+    }
+
+    friend bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.pos_ < rhs.pos_;
+    }
+
+    friend bool operator>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return !(lhs < rhs);
+    }
+
+private:
+    template<bool>
+    friend class basic_iterator;
+
+    owner_type* owner_;
+    size_type pos_;
+};
+
+template<typename OverflowPolicy, typename... Ts>
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::BasicSoACircularBuffer(size_type capacity)
+        : columns_()
+        , capacity_(capacity)
+        , tail_(0)
+        , size_(0)
+        , overflow_count_(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Capacity must be greater than 0");
+    }
+    allocate_columns();
+}
+
+template<typename OverflowPolicy, typename... Ts>
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::BasicSoACircularBuffer(const BasicSoACircularBuffer& other)
+        : columns_()
+        , capacity_(0)
+        , tail_(0)
+        , size_(0)
+        , overflow_count_(0) {
+    if (other.capacity_ == 0) {
+        return;
+    }
+
+    BasicSoACircularBuffer temp(other.capacity_);
+    for (const auto& values : other) {
+        std::apply([&temp](const Ts&... fields) { temp.push(fields...); }, values);
+    }
+    temp.overflow_count_ = other.overflow_count_;
+    swap(temp);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::BasicSoACircularBuffer(BasicSoACircularBuffer&& other) noexcept
+        : columns_(std::exchange(other.columns_, std::tuple<Ts*...>()))
+        , capacity_(std::exchange(other.capacity_, 0))
+        , tail_(std::exchange(other.tail_, 0))
+        , size_(std::exchange(other.size_, 0))
+        , overflow_count_(std::exchange(other.overflow_count_, 0)) {
+}
+
+template<typename OverflowPolicy, typename... Ts>
+BasicSoACircularBuffer<OverflowPolicy, Ts...>&
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::operator=(const BasicSoACircularBuffer& other) {
+    if (this != &other) {
+        BasicSoACircularBuffer temp(other);
+        swap(temp);
+    }
+    return *this;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+BasicSoACircularBuffer<OverflowPolicy, Ts...>&
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::operator=(BasicSoACircularBuffer&& other) noexcept {
+    if (this != &other) {
+        BasicSoACircularBuffer temp(std::move(other));
+        swap(temp);
+    }
+    return *this;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::~BasicSoACircularBuffer() {
+    clear();
+    deallocate_columns();
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::size_type
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::slot_index(size_type position) const noexcept {
+    return position < capacity_ ? position : position - capacity_;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+void BasicSoACircularBuffer<OverflowPolicy, Ts...>::allocate_columns() {
+    try {
+        [this]<std::size_t... I>(std::index_sequence<I...>) {
+            ((std::get<I>(columns_) = std::allocator<column_type<I>>().allocate(capacity_)), ...);
+        }(indices());
+    } catch (...) {
+        deallocate_columns();
+        throw;
+    }
+}
+
+template<typename OverflowPolicy, typename... Ts>
+void BasicSoACircularBuffer<OverflowPolicy, Ts...>::deallocate_columns() noexcept {
+    [this]<std::size_t... I>(std::index_sequence<I...>) {
+        ((std::get<I>(columns_) ? std::allocator<column_type<I>>().deallocate(std::get<I>(columns_), capacity_)
+                                : void()), ...);
+    }(indices());
+}
+
+template<typename OverflowPolicy, typename... Ts>
+template<typename... Args>
+void BasicSoACircularBuffer<OverflowPolicy, Ts...>::construct_row(size_type slot, Args&&... args) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        std::size_t constructed = 0;
+        try {
+            ((std::construct_at(std::get<I>(columns_) + slot, std::forward<Args>(args)), ++constructed), ...);
+        } catch (...) {
+            ((I < constructed ? std::destroy_at(std::get<I>(columns_) + slot) : void()), ...);
+            throw;
+        }
+    }(indices());
+}
+
+template<typename OverflowPolicy, typename... Ts>
+template<typename... Args>
+void BasicSoACircularBuffer<OverflowPolicy, Ts...>::assign_row(size_type slot, Args&&... args) {
+    [&]<std::size_t... I>(std::index_sequence<I...>) {
+        ((std::get<I>(columns_)[slot] = std::forward<Args>(args)), ...);
+    }(indices());
+}
+
+template<typename OverflowPolicy, typename... Ts>
+void BasicSoACircularBuffer<OverflowPolicy, Ts...>::destroy_row(size_type slot) noexcept {
+    std::apply([slot](auto*... column) { (std::destroy_at(column + slot), ...); }, columns_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::reference
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::row(size_type slot) noexcept {
+    return std::apply([slot](auto*... column) { return reference(column[slot]...); }, columns_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::const_reference
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::row(size_type slot) const noexcept {
+    return std::apply([slot](const auto*... column) { return const_reference(column[slot]...); }, columns_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+void BasicSoACircularBuffer<OverflowPolicy, Ts...>::swap(BasicSoACircularBuffer& other) noexcept {
+    std::swap(columns_, other.columns_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(tail_, other.tail_);
+    std::swap(size_, other.size_);
+    std::swap(overflow_count_, other.overflow_count_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::reference
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::front() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return row(tail_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::const_reference
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::front() const {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return row(tail_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::reference
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::back() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return row(slot_index(tail_ + size_ - 1));
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::const_reference
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::back() const {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return row(slot_index(tail_ + size_ - 1));
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::reference
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::operator[](size_type index) {
+    if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+    }
+    return row(slot_index(tail_ + index));
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::const_reference
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::operator[](size_type index) const {
+    if (index >= size_) {
+        throw std::out_of_range("Index out of range");
+    }
+    return row(slot_index(tail_ + index));
+}
+
+template<typename OverflowPolicy, typename... Ts>
+bool BasicSoACircularBuffer<OverflowPolicy, Ts...>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+bool BasicSoACircularBuffer<OverflowPolicy, Ts...>::full() const noexcept {
+    return size_ == capacity_;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::size_type
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::size() const noexcept {
+    return size_;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::size_type
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::capacity() const noexcept {
+    return capacity_;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+std::uint64_t BasicSoACircularBuffer<OverflowPolicy, Ts...>::overflow_count() const noexcept {
+    return overflow_count_;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+template<std::size_t I>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::template column_view<
+        typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::template column_type<I>>
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::column() noexcept {
+    return column_view<column_type<I>>(std::get<I>(columns_), capacity_, tail_, size_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+template<std::size_t I>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::template column_view<
+        const typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::template column_type<I>>
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::column() const noexcept {
+    return column_view<const column_type<I>>(std::get<I>(columns_), capacity_, tail_, size_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+template<typename... Args>
+bool BasicSoACircularBuffer<OverflowPolicy, Ts...>::push_row(Args&&... args) {
+    if (full()) {
+        if constexpr (OverflowPolicy::overwrite) {
+            assign_row(tail_, std::forward<Args>(args)...);
+            tail_ = slot_index(tail_ + 1);
+            ++overflow_count_;
+            return true;
+        } else {
+            if constexpr (OverflowPolicy::count_overflow) {
+                ++overflow_count_;
+            }
+            return false;
+        }
+    }
+    construct_row(slot_index(tail_ + size_), std::forward<Args>(args)...);
+    ++size_;
+    return true;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+bool BasicSoACircularBuffer<OverflowPolicy, Ts...>::push(const Ts&... values) {
+    return push_row(values...);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+bool BasicSoACircularBuffer<OverflowPolicy, Ts...>::push(Ts&&... values) {
+    return push_row(std::move(values)...);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+void BasicSoACircularBuffer<OverflowPolicy, Ts...>::pop() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    pop_n(1);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::size_type
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::pop_n(size_type count) {
+    count = std::min(count, size_);
+    if constexpr (!(std::is_trivially_destructible_v<Ts> && ...)) {
+        for (size_type i = 0; i < count; ++i) {
+            destroy_row(slot_index(tail_ + i));
+        }
+    }
+    tail_ = slot_index(tail_ + count);
+    size_ -= count;
+    return count;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+void BasicSoACircularBuffer<OverflowPolicy, Ts...>::clear() noexcept {
+    pop_n(size_);
+    tail_ = 0;
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::iterator
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::begin() noexcept {
+    return iterator(this, 0);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::const_iterator
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::begin() const noexcept {
+    return const_iterator(this, 0);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::const_iterator
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::cbegin() const noexcept {
+    return begin();
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::iterator
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::end() noexcept {
+    return iterator(this, size_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::const_iterator
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::end() const noexcept {
+    return const_iterator(this, size_);
+}
+
+template<typename OverflowPolicy, typename... Ts>
+typename BasicSoACircularBuffer<OverflowPolicy, Ts...>::const_iterator
+BasicSoACircularBuffer<OverflowPolicy, Ts...>::cend() const noexcept {
+    return end();
+}
+
+#endif
@@ -0,0 +1,259 @@
+#ifndef SPSC_CIRCULAR_BUFFER_HPP
+#define SPSC_CIRCULAR_BUFFER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#if __has_include(<span>) && __cplusplus >= 202002L
+#include <span>
+#endif
+
+template<typename T>
+class SpscCircularBuffer {
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using const_array_range = std::pair<const_pointer, size_type>;
+
+    class ReadView;
+
+    explicit SpscCircularBuffer(size_type capacity);
+
+    SpscCircularBuffer(const SpscCircularBuffer&) = delete;
+    SpscCircularBuffer& operator=(const SpscCircularBuffer&) = delete;
+    ~SpscCircularBuffer();
+
+    [[nodiscard]] bool try_push(const_reference value);
+    [[nodiscard]] bool try_push(T&& value);
+    template<typename... Args>
+    [[nodiscard]] bool try_emplace(Args&&... args);
+
+    [[nodiscard]] bool try_pop(T& value);
+    [[nodiscard]] pointer front() noexcept;
+    void pop();
+    size_type pop_n(size_type count);
+    [[nodiscard]] ReadView read_view() noexcept;
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] bool full() const noexcept;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+
+private:
+    static constexpr size_type cache_line_size = 64;
+
+    T* buffer_;
+    size_type capacity_;
+
+    alignas(cache_line_size) std::atomic<size_type> head_;
+    size_type cached_tail_;
+
+    alignas(cache_line_size) std::atomic<size_type> tail_;
+    size_type cached_head_;
+
+    size_type next_index(size_type index) const noexcept;
+};
+
+
+template<typename T>
+class SpscCircularBuffer<T>::ReadView {
+public:
+    [[nodiscard]] const_array_range array_one() const noexcept;
+    [[nodiscard]] const_array_range array_two() const noexcept;
+#ifdef __cpp_lib_span
+    [[nodiscard]] std::pair<std::span<const T>, std::span<const T>> segments() const noexcept;
+#endif
+    [[nodiscard]] const_reference operator[](size_type index) const;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] bool empty() const noexcept;
+
+private:
+    friend class SpscCircularBuffer;
+
+    ReadView(const_array_range first, const_array_range second) noexcept;
+
+    const_array_range first_;
+    const_array_range second_;
+};
+
+template<typename T>
+SpscCircularBuffer<T>::SpscCircularBuffer(size_type capacity)
+        : buffer_(nullptr)
+        , capacity_(capacity)
+        , head_(0)
+        , cached_tail_(0)
+        , tail_(0)
+        , cached_head_(0) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Capacity must be greater than 0");
+    }
+    buffer_ = std::allocator<T>().allocate(capacity + 1);
+}
+
+template<typename T>
+SpscCircularBuffer<T>::~SpscCircularBuffer() {
+    while (front() != nullptr) {
+        pop();
+    }
+    std::allocator<T>().deallocate(buffer_, capacity_ + 1);
+}
+
+template<typename T>
+typename SpscCircularBuffer<T>::size_type
+SpscCircularBuffer<T>::next_index(size_type index) const noexcept {
+    return index == capacity_ ? 0 : index + 1;
+}
+
+template<typename T>
+bool SpscCircularBuffer<T>::try_push(const_reference value) {
+    return try_emplace(value);
+}
+
+template<typename T>
+bool SpscCircularBuffer<T>::try_push(T&& value) {
+    return try_emplace(std::move(value));
+}
+
+template<typename T>
+template<typename... Args>
+bool SpscCircularBuffer<T>::try_emplace(Args&&... args) {
+    const size_type head = head_.load(std::memory_order_relaxed);
+    const size_type next = next_index(head);
+    if (next == cached_tail_) {
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (next == cached_tail_) {
+            return false;
+        }
+    }
+    ::new (static_cast<void*>(buffer_ + head)) T(std::forward<Args>(args)...);
+    head_.store(next, std::memory_order_release);
+    return true;
+}
+
+template<typename T>
+typename SpscCircularBuffer<T>::pointer SpscCircularBuffer<T>::front() noexcept {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    if (tail == cached_head_) {
+        cached_head_ = head_.load(std::memory_order_acquire);
+        if (tail == cached_head_) {
+            return nullptr;
+        }
+    }
+    return &buffer_[tail];
+}
+
+template<typename T>
+void SpscCircularBuffer<T>::pop() {
+    if (front() == nullptr) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    std::destroy_at(buffer_ + tail);
+    tail_.store(next_index(tail), std::memory_order_release);
+}
+
+template<typename T>
+typename SpscCircularBuffer<T>::size_type SpscCircularBuffer<T>::pop_n(size_type count) {
+    size_type tail = tail_.load(std::memory_order_relaxed);
+    cached_head_ = head_.load(std::memory_order_acquire);
+    size_type popped = 0;
+    for (; popped < count && tail != cached_head_; ++popped) {
+        std::destroy_at(buffer_ + tail);
+        tail = next_index(tail);
+    }
+    tail_.store(tail, std::memory_order_release);
+    return popped;
+}
+
+template<typename T>
+typename SpscCircularBuffer<T>::ReadView SpscCircularBuffer<T>::read_view() noexcept {
+    const size_type tail = tail_.load(std::memory_order_relaxed);
+    cached_head_ = head_.load(std::memory_order_acquire);
+    if (cached_head_ >= tail) {
+        return ReadView(const_array_range(buffer_ + tail, cached_head_ - tail), const_array_range(buffer_, 0));
+    }
+    return ReadView(const_array_range(buffer_ + tail, capacity_ + 1 - tail), const_array_range(buffer_, cached_head_));
+}
+
+template<typename T>
+bool SpscCircularBuffer<T>::try_pop(T& value) {
+    pointer element = front();
+    if (element == nullptr) {
+        return false;
+    }
+    value = std::move(*element);
+    pop();
+    return true;
+}
+
+template<typename T>
+bool SpscCircularBuffer<T>::empty() const noexcept {
+    return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+}
+
+template<typename T>
+bool SpscCircularBuffer<T>::full() const noexcept {
+    return size() == capacity_;
+}
+
+template<typename T>
+typename SpscCircularBuffer<T>::size_type SpscCircularBuffer<T>::size() const noexcept {
+    const size_type head = head_.load(std::memory_order_acquire);
+    const size_type tail = tail_.load(std::memory_order_acquire);
+    return head >= tail ? head - tail : head + capacity_ + 1 - tail;
+}
+
+template<typename T>
+typename SpscCircularBuffer<T>::size_type SpscCircularBuffer<T>::capacity() const noexcept {
+    return capacity_;
+}
+
+template<typename T>
+SpscCircularBuffer<T>::ReadView::ReadView(const_array_range first, const_array_range second) noexcept
+        : first_(first)
+        , second_(second) {
+}
+
+template<typename T>
+typename SpscCircularBuffer<T>::const_array_range SpscCircularBuffer<T>::ReadView::array_one() const noexcept {
+    return first_;
+}
+
+template<typename T>
+typename SpscCircularBuffer<T>::const_array_range SpscCircularBuffer<T>::ReadView::array_two() const noexcept {
+    return second_;
+}
+
+#ifdef __cpp_lib_span
+template<typename T>
+std::pair<std::span<const T>, std::span<const T>> SpscCircularBuffer<T>::ReadView::segments() const noexcept {
+    return {std::span<const T>(first_.first, first_.second), std::span<const T>(second_.first, second_.second)};
+}
+#endif
+
+template<typename T>
+typename SpscCircularBuffer<T>::const_reference SpscCircularBuffer<T>::ReadView::operator[](size_type index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return index < first_.second ? first_.first[index] : second_.first[index - first_.second];
+}
+
+template<typename T>
+typename SpscCircularBuffer<T>::size_type SpscCircularBuffer<T>::ReadView::size() const noexcept {
+    return first_.second + second_.second;
+}
+
+template<typename T>
+bool SpscCircularBuffer<T>::ReadView::empty() const noexcept {
+    return size() == 0;
+}
+
+#endif
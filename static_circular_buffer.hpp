@@ -0,0 +1,713 @@
+#ifndef STATIC_CIRCULAR_BUFFER_HPP
+#define STATIC_CIRCULAR_BUFFER_HPP
+
+#include "circular_buffer.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template<typename T, std::size_t N, typename OverflowPolicy = OverwriteOldest>
+class StaticCircularBuffer {
+    static_assert(N > 0, "Capacity must be greater than 0");
+    static_assert(!OverflowPolicy::grow, "StaticCircularBuffer cannot grow its capacity");
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using size_type = std::size_t;
+    using array_range = std::pair<pointer, size_type>;
+    using const_array_range = std::pair<const_pointer, size_type>;
+
+    constexpr StaticCircularBuffer() noexcept;
+    constexpr StaticCircularBuffer(size_type count, const_reference value);
+    constexpr StaticCircularBuffer(std::initializer_list<T> init);
+
+    constexpr StaticCircularBuffer(const StaticCircularBuffer& other);
+    constexpr StaticCircularBuffer(StaticCircularBuffer&& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+    constexpr StaticCircularBuffer& operator=(const StaticCircularBuffer& other);
+    constexpr StaticCircularBuffer& operator=(StaticCircularBuffer&& other) noexcept(
+            std::is_nothrow_move_constructible_v<T>);
+    constexpr ~StaticCircularBuffer() requires std::is_trivially_destructible_v<T> = default;
+    constexpr ~StaticCircularBuffer();
+
+    constexpr reference front();
+    constexpr const_reference front() const;
+    constexpr reference back();
+    constexpr const_reference back() const;
+    constexpr reference operator[](size_type index);
+    constexpr const_reference operator[](size_type index) const;
+
+    [[nodiscard]] constexpr bool empty() const noexcept;
+    [[nodiscard]] constexpr bool full() const noexcept;
+    [[nodiscard]] constexpr size_type size() const noexcept;
+    [[nodiscard]] static constexpr size_type capacity() noexcept;
+    [[nodiscard]] constexpr std::uint64_t overflow_count() const noexcept;
+
+    constexpr array_range array_one() noexcept;
+    constexpr const_array_range array_one() const noexcept;
+    constexpr array_range array_two() noexcept;
+    constexpr const_array_range array_two() const noexcept;
+    constexpr std::pair<std::span<T>, std::span<T>> segments() noexcept;
+    constexpr std::pair<std::span<const T>, std::span<const T>> segments() const noexcept;
+    [[nodiscard]] constexpr bool is_linearized() const noexcept;
+    constexpr pointer linearize();
+
+    constexpr bool push(const_reference value);
+    constexpr bool push(T&& value);
+    template<typename... Args>
+    constexpr bool emplace(Args&&... args);
+    constexpr void pop();
+    template<typename InputIt>
+    constexpr size_type push_range(InputIt first, InputIt last);
+    constexpr size_type pop_n(size_type count);
+    template<typename OutputIt>
+    constexpr OutputIt pop_into(OutputIt out, size_type count);
+    constexpr size_type write(const T* data, size_type count);
+    constexpr size_type read(T* out, size_type count);
+    constexpr size_type write(std::span<const T> data);
+    constexpr size_type read(std::span<T> out);
+    constexpr void clear() noexcept;
+
+    template<typename ValueType>
+    class basic_iterator;
+    using iterator = basic_iterator<T>;
+    using const_iterator = basic_iterator<const T>;
+
+    constexpr iterator begin() noexcept;
+    constexpr const_iterator begin() const noexcept;
+    constexpr const_iterator cbegin() const noexcept;
+    constexpr iterator end() noexcept;
+    constexpr const_iterator end() const noexcept;
+    constexpr const_iterator cend() const noexcept;
+
+private:
+    union Slot {
+        constexpr Slot() noexcept {}
+        constexpr ~Slot() requires std::is_trivially_destructible_v<T> = default;
+        constexpr ~Slot() {}
+
+        T value;
+    };
+
+    static_assert(sizeof(Slot) == sizeof(T) && alignof(Slot) == alignof(T),
+                  "StaticCircularBuffer requires slots laid out like an array of T");
+
+    Slot slots_[N];
+    size_type tail_;
+    size_type size_;
+    std::uint64_t overflow_count_;
+
+    static constexpr size_type slot_index(size_type position) noexcept;
+    constexpr size_type tail_slot() const noexcept;
+    constexpr size_type head_slot() const noexcept;
+    template<typename... Args>
+    constexpr void construct_element(size_type slot, Args&&... args);
+    constexpr void destroy_element(size_type slot) noexcept;
+    constexpr bool occupied(size_type slot) const noexcept;
+    constexpr size_type rotate_cycle(size_type start);
+    constexpr bool make_room();
+    constexpr void discard_front(size_type count) noexcept;
+};
+
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+template<typename ValueType>
+class StaticCircularBuffer<T, N, OverflowPolicy>::basic_iterator {
+    using owner_type = std::conditional_t<std::is_const_v<ValueType>, const StaticCircularBuffer, StaticCircularBuffer>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::remove_const_t<ValueType>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = ValueType*;
+    using reference = ValueType&;
+
+    constexpr basic_iterator() noexcept
+            : owner_(nullptr), pos_(0) {}
+
+    constexpr basic_iterator(owner_type* owner, size_type pos) noexcept
+            : owner_(owner), pos_(pos) {}
+
+    template<typename OtherValueType,
+             typename = std::enable_if_t<std::is_convertible_v<OtherValueType*, ValueType*>>>
+    constexpr basic_iterator(const basic_iterator<OtherValueType>& other) noexcept
+            : owner_(other.owner_), pos_(other.pos_) {}
+
+    constexpr reference operator*() const noexcept {
+        return owner_->slots_[slot_index(owner_->tail_ + pos_)].value;
+    }
+
+    constexpr pointer operator->() const noexcept {
+        return &**this;
+    }
+
+    constexpr reference operator[](difference_type n) const noexcept {
+        return *(*this + n);
+    }
+
+    constexpr basic_iterator& operator++() noexcept {
+        ++pos_;
+        return *this;
+    }
+
+    constexpr basic_iterator operator++(int) noexcept {
+        basic_iterator temp = *this;
+        ++pos_;
+        return temp;
+    }
+
+    constexpr basic_iterator& operator--() noexcept {
+        --pos_;
+        return *this;
+    }
+
+    constexpr basic_iterator operator--(int) noexcept {
+        basic_iterator temp = *this;
+        --pos_;
+        return temp;
+    }
+
+    constexpr basic_iterator& operator+=(difference_type n) noexcept {
+        pos_ += n;
+        return *this;
+    }
+
+    constexpr basic_iterator& operator-=(difference_type n) noexcept {
+        pos_ -= n;
+        return *this;
+    }
+
+    friend constexpr basic_iterator operator+(basic_iterator it, difference_type n) noexcept {
+        return it += n;
+    }
+
+    friend constexpr basic_iterator operator+(difference_type n, basic_iterator it) noexcept {
+        return it += n;
+    }
+
+    friend constexpr basic_iterator operator-(basic_iterator it, difference_type n) noexcept {
+        return it -= n;
+    }
+
+    friend constexpr difference_type operator-(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return static_cast<difference_type>(lhs.pos_) - static_cast<difference_type>(rhs.pos_);
+    }
+
+    friend constexpr bool operator==(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.owner_ == rhs.owner_ && lhs.pos_ == rhs.pos_;
+    }
+
+    friend constexpr bool operator!=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return !(lhs == rhs);
+    }
+
+    friend constexpr bool operator<(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return lhs.pos_ < rhs.pos_;
+    }
+
+    friend constexpr bool operator>(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return rhs < lhs;
+    }
+
+    friend constexpr bool operator<=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return !(rhs < lhs);
+    }
+
+    friend constexpr bool operator>=(const basic_iterator& lhs, const basic_iterator& rhs) noexcept {
+        return !(lhs < rhs);
+    }
+
+private:
+    template<typename>
+    friend class basic_iterator;
+
+    owner_type* owner_;
+    size_type pos_;
+};
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr StaticCircularBuffer<T, N, OverflowPolicy>::StaticCircularBuffer() noexcept
+        : tail_(0)
+        , size_(0)
+        , overflow_count_(0) {
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr StaticCircularBuffer<T, N, OverflowPolicy>::StaticCircularBuffer(size_type count, const_reference value)
+        : StaticCircularBuffer() {
+    for (size_type i = 0; i < count; ++i) {
+        push(value);
+    }
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr StaticCircularBuffer<T, N, OverflowPolicy>::StaticCircularBuffer(std::initializer_list<T> init)
+        : StaticCircularBuffer() {
+    push_range(init.begin(), init.end());
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr StaticCircularBuffer<T, N, OverflowPolicy>::StaticCircularBuffer(const StaticCircularBuffer& other)
+        : StaticCircularBuffer() {
+    push_range(other.begin(), other.end());
+    overflow_count_ = other.overflow_count_;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr StaticCircularBuffer<T, N, OverflowPolicy>::StaticCircularBuffer(StaticCircularBuffer&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>)
+        : StaticCircularBuffer() {
+    push_range(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    overflow_count_ = other.overflow_count_;
+    other.clear();
+    other.overflow_count_ = 0;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr StaticCircularBuffer<T, N, OverflowPolicy>&
+StaticCircularBuffer<T, N, OverflowPolicy>::operator=(const StaticCircularBuffer& other) {
+    if (this != &other) {
+        clear();
+        push_range(other.begin(), other.end());
+        overflow_count_ = other.overflow_count_;
+    }
+    return *this;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr StaticCircularBuffer<T, N, OverflowPolicy>&
+StaticCircularBuffer<T, N, OverflowPolicy>::operator=(StaticCircularBuffer&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T>) {
+    if (this != &other) {
+        clear();
+        push_range(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        overflow_count_ = other.overflow_count_;
+        other.clear();
+        other.overflow_count_ = 0;
+    }
+    return *this;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr StaticCircularBuffer<T, N, OverflowPolicy>::~StaticCircularBuffer() {
+    clear();
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::slot_index(size_type position) noexcept {
+    return position % N;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::tail_slot() const noexcept {
+    return tail_;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::head_slot() const noexcept {
+    return slot_index(tail_ + size_);
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+template<typename... Args>
+constexpr void StaticCircularBuffer<T, N, OverflowPolicy>::construct_element(size_type slot, Args&&... args) {
+    std::construct_at(&slots_[slot].value, std::forward<Args>(args)...);
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr void StaticCircularBuffer<T, N, OverflowPolicy>::destroy_element(size_type slot) noexcept {
+    std::destroy_at(&slots_[slot].value);
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr bool StaticCircularBuffer<T, N, OverflowPolicy>::make_room() {
+    if constexpr (OverflowPolicy::count_overflow) {
+        ++overflow_count_;
+    }
+    return false;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr void StaticCircularBuffer<T, N, OverflowPolicy>::discard_front(size_type count) noexcept {
+    if constexpr (!std::is_trivially_destructible_v<T>) {
+        for (size_type i = 0; i < count; ++i) {
+            destroy_element(slot_index(tail_ + i));
+        }
+    }
+    tail_ = slot_index(tail_ + count);
+    size_ -= count;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::reference
+StaticCircularBuffer<T, N, OverflowPolicy>::front() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return slots_[tail_slot()].value;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::const_reference
+StaticCircularBuffer<T, N, OverflowPolicy>::front() const {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return slots_[tail_slot()].value;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::reference
+StaticCircularBuffer<T, N, OverflowPolicy>::back() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return slots_[slot_index(tail_ + size_ - 1)].value;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::const_reference
+StaticCircularBuffer<T, N, OverflowPolicy>::back() const {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    return slots_[slot_index(tail_ + size_ - 1)].value;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::reference
+StaticCircularBuffer<T, N, OverflowPolicy>::operator[](size_type index) {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return slots_[slot_index(tail_ + index)].value;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::const_reference
+StaticCircularBuffer<T, N, OverflowPolicy>::operator[](size_type index) const {
+    if (index >= size()) {
+        throw std::out_of_range("Index out of range");
+    }
+    return slots_[slot_index(tail_ + index)].value;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr bool StaticCircularBuffer<T, N, OverflowPolicy>::empty() const noexcept {
+    return size_ == 0;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr bool StaticCircularBuffer<T, N, OverflowPolicy>::full() const noexcept {
+    return size_ == N;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::size() const noexcept {
+    return size_;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::capacity() noexcept {
+    return N;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr std::uint64_t StaticCircularBuffer<T, N, OverflowPolicy>::overflow_count() const noexcept {
+    return overflow_count_;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::array_range
+StaticCircularBuffer<T, N, OverflowPolicy>::array_one() noexcept {
+    return array_range(&slots_[tail_].value, std::min(size_, N - tail_));
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::const_array_range
+StaticCircularBuffer<T, N, OverflowPolicy>::array_one() const noexcept {
+    return const_array_range(&slots_[tail_].value, std::min(size_, N - tail_));
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::array_range
+StaticCircularBuffer<T, N, OverflowPolicy>::array_two() noexcept {
+    return array_range(&slots_[0].value, size_ - std::min(size_, N - tail_));
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::const_array_range
+StaticCircularBuffer<T, N, OverflowPolicy>::array_two() const noexcept {
+    return const_array_range(&slots_[0].value, size_ - std::min(size_, N - tail_));
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr std::pair<std::span<T>, std::span<T>> StaticCircularBuffer<T, N, OverflowPolicy>::segments() noexcept {
+    const auto [first, first_size] = array_one();
+    const auto [second, second_size] = array_two();
+    return {std::span<T>(first, first_size), std::span<T>(second, second_size)};
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr std::pair<std::span<const T>, std::span<const T>>
+StaticCircularBuffer<T, N, OverflowPolicy>::segments() const noexcept {
+    const auto [first, first_size] = array_one();
+    const auto [second, second_size] = array_two();
+    return {std::span<const T>(first, first_size), std::span<const T>(second, second_size)};
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr bool StaticCircularBuffer<T, N, OverflowPolicy>::is_linearized() const noexcept {
+    return tail_ + size_ <= N;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr bool StaticCircularBuffer<T, N, OverflowPolicy>::occupied(size_type slot) const noexcept {
+    return slot_index(slot + N - tail_) < size_;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::rotate_cycle(size_type start) {
+    size_type slot = start;
+    for (size_type next = slot_index(slot + tail_); next != start; next = slot_index(slot + tail_)) {
+        if (occupied(next)) {
+            construct_element(slot, std::move(slots_[next].value));
+            destroy_element(next);
+        }
+        slot = next;
+    }
+    return slot;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::pointer
+StaticCircularBuffer<T, N, OverflowPolicy>::linearize() {
+    if (is_linearized()) {
+        return &slots_[tail_].value;
+    }
+
+    for (size_type start = 0, cycles = std::gcd(N, tail_); start < cycles; ++start) {
+        if (!occupied(start)) {
+            rotate_cycle(start);
+            continue;
+        }
+        T hold(std::move(slots_[start].value));
+        destroy_element(start);
+        construct_element(rotate_cycle(start), std::move(hold));
+    }
+    tail_ = 0;
+    return &slots_[0].value;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr bool StaticCircularBuffer<T, N, OverflowPolicy>::push(const_reference value) {
+    if (full()) {
+        if constexpr (OverflowPolicy::overwrite) {
+            slots_[tail_].value = value;
+            tail_ = slot_index(tail_ + 1);
+            ++overflow_count_;
+            return true;
+        } else {
+            return make_room();
+        }
+    }
+    construct_element(head_slot(), value);
+    ++size_;
+    return true;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr bool StaticCircularBuffer<T, N, OverflowPolicy>::push(T&& value) {
+    if (full()) {
+        if constexpr (OverflowPolicy::overwrite) {
+            slots_[tail_].value = std::move(value);
+            tail_ = slot_index(tail_ + 1);
+            ++overflow_count_;
+            return true;
+        } else {
+            return make_room();
+        }
+    }
+    construct_element(head_slot(), std::move(value));
+    ++size_;
+    return true;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+template<typename... Args>
+constexpr bool StaticCircularBuffer<T, N, OverflowPolicy>::emplace(Args&&... args) {
+    if (full()) {
+        if constexpr (OverflowPolicy::overwrite) {
+            discard_front(1);
+            ++overflow_count_;
+        } else {
+            return make_room();
+        }
+    }
+    construct_element(head_slot(), std::forward<Args>(args)...);
+    ++size_;
+    return true;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr void StaticCircularBuffer<T, N, OverflowPolicy>::pop() {
+    if (empty()) {
+        throw std::runtime_error("Buffer is empty");
+    }
+    destroy_element(tail_);
+    tail_ = slot_index(tail_ + 1);
+    --size_;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+template<typename InputIt>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::push_range(InputIt first, InputIt last) {
+    using category = typename std::iterator_traits<InputIt>::iterator_category;
+    if constexpr (!std::is_base_of_v<std::forward_iterator_tag, category>) {
+        size_type accepted = 0;
+        for (; first != last; ++first) {
+            accepted += push(*first) ? 1 : 0;
+        }
+        return accepted;
+    } else {
+        auto count = static_cast<size_type>(std::distance(first, last));
+        const size_type accepted = OverflowPolicy::overwrite ? count : std::min(count, N - size_);
+        if constexpr (OverflowPolicy::overwrite) {
+            if (size_ + count > N) {
+                overflow_count_ += size_ + count - N;
+            }
+            if (count >= N) {
+                std::advance(first, count - N);
+                count = N;
+                clear();
+            } else if (size_ + count > N) {
+                discard_front(size_ + count - N);
+            }
+        } else {
+            if constexpr (OverflowPolicy::count_overflow) {
+                overflow_count_ += count - accepted;
+            }
+            count = accepted;
+        }
+
+        const size_type start = head_slot();
+        const size_type first_segment = std::min(count, N - start);
+        for (const auto& [offset, length] : {std::pair<size_type, size_type>(start, first_segment),
+                                            std::pair<size_type, size_type>(0, count - first_segment)}) {
+            for (size_type i = 0; i < length; ++i, ++first) {
+                construct_element(offset + i, *first);
+                ++size_;
+            }
+        }
+        return accepted;
+    }
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::pop_n(size_type count) {
+    count = std::min(count, size_);
+    discard_front(count);
+    return count;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+template<typename OutputIt>
+constexpr OutputIt StaticCircularBuffer<T, N, OverflowPolicy>::pop_into(OutputIt out, size_type count) {
+    count = std::min(count, size_);
+    const size_type first_segment = std::min(count, N - tail_);
+    for (const size_type length : {first_segment, count - first_segment}) {
+        for (size_type i = 0; i < length; ++i, ++out) {
+            *out = std::move(slots_[tail_ + i].value);
+        }
+        discard_front(length);
+    }
+    return out;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::write(const T* data, size_type count) {
+    return push_range(data, data + count);
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::read(T* out, size_type count) {
+    return static_cast<size_type>(pop_into(out, count) - out);
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::write(std::span<const T> data) {
+    return write(data.data(), data.size());
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::size_type
+StaticCircularBuffer<T, N, OverflowPolicy>::read(std::span<T> out) {
+    return read(out.data(), out.size());
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr void StaticCircularBuffer<T, N, OverflowPolicy>::clear() noexcept {
+    discard_front(size_);
+    tail_ = 0;
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::iterator
+StaticCircularBuffer<T, N, OverflowPolicy>::begin() noexcept {
+    return iterator(this, 0);
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::const_iterator
+StaticCircularBuffer<T, N, OverflowPolicy>::begin() const noexcept {
+    return const_iterator(this, 0);
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::const_iterator
+StaticCircularBuffer<T, N, OverflowPolicy>::cbegin() const noexcept {
+    return begin();
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::iterator
+StaticCircularBuffer<T, N, OverflowPolicy>::end() noexcept {
+    return iterator(this, size_);
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::const_iterator
+StaticCircularBuffer<T, N, OverflowPolicy>::end() const noexcept {
+    return const_iterator(this, size_);
+}
+
+template<typename T, std::size_t N, typename OverflowPolicy>
+constexpr typename StaticCircularBuffer<T, N, OverflowPolicy>::const_iterator
+StaticCircularBuffer<T, N, OverflowPolicy>::cend() const noexcept {
+    return end();
+}
+
+#endif
@@ -0,0 +1,139 @@
+#include "async_channel.hpp"
+#include "gtest/gtest.h"
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Channel = AsyncChannel<int, EventLoop>;
+
+AsyncTask produce(Channel& channel, int first, int count, std::vector<bool>& results) {
+    for (int i = first; i < first + count; ++i) {
+        results.push_back(co_await channel.push(i));
+    }
+}
+
+AsyncTask consume(Channel& channel, std::vector<int>& received) {
+    while (std::optional<int> value = co_await channel.pop()) {
+        received.push_back(*value);
+    }
+}
+
+AsyncTask consume_one(Channel& channel, long long& sum, int& finished) {
+    if (std::optional<int> value = co_await channel.pop()) {
+        sum += *value;
+    }
+    ++finished;
+}
+
+}
+
+
+TEST(AsyncChannelTest, TryPushAndPop) {
+EventLoop loop;
+AsyncChannel<std::string, EventLoop> channel(2, loop);
+EXPECT_EQ(channel.capacity(), 2);
+std::string a = "a";
+std::string b = "b";
+std::string c = "c";
+EXPECT_TRUE(channel.try_push(a));
+EXPECT_TRUE(channel.try_push(b));
+EXPECT_FALSE(channel.try_push(c));
+EXPECT_EQ(c, "c");
+EXPECT_EQ(channel.size(), 2);
+EXPECT_EQ(channel.try_pop(), "a");
+EXPECT_EQ(channel.try_pop(), "b");
+EXPECT_EQ(channel.try_pop(), std::nullopt);
+}
+
+TEST(AsyncChannelTest, InvalidCapacityThrows) {
+EventLoop loop;
+EXPECT_THROW(Channel(0, loop), std::invalid_argument);
+}
+
+TEST(AsyncChannelTest, ProducerSuspendsWhenFull) {
+EventLoop loop;
+Channel channel(2, loop);
+std::vector<bool> results;
+loop.spawn(produce(channel, 0, 5, results));
+loop.run();
+EXPECT_EQ(results.size(), 2u);
+EXPECT_EQ(channel.size(), 2);
+
+EXPECT_EQ(channel.try_pop(), 0);
+loop.run();
+EXPECT_EQ(results.size(), 3u);
+EXPECT_EQ(channel.size(), 2);
+
+std::vector<int> received;
+loop.spawn(consume(channel, received));
+loop.run();
+EXPECT_EQ(results, std::vector<bool>(5, true));
+EXPECT_EQ(received, (std::vector<int>{1, 2, 3, 4}));
+
+channel.close();
+loop.run();
+EXPECT_TRUE(loop.idle());
+}
+
+TEST(AsyncChannelTest, ConsumerSuspendsWhenEmpty) {
+EventLoop loop;
+Channel channel(4, loop);
+std::vector<int> received;
+loop.spawn(consume(channel, received));
+loop.run();
+EXPECT_TRUE(received.empty());
+
+int value = 7;
+EXPECT_TRUE(channel.try_push(value));
+EXPECT_EQ(channel.size(), 0);
+loop.run();
+EXPECT_EQ(received, std::vector<int>{7});
+
+channel.close();
+loop.run();
+EXPECT_TRUE(channel.closed());
+}
+
+TEST(AsyncChannelTest, CloseWakesAllWaiters) {
+EventLoop loop;
+Channel full(1, loop);
+Channel empty(1, loop);
+std::vector<bool> results;
+long long sum = 0;
+int finished = 0;
+loop.spawn(produce(full, 0, 3, results));
+loop.spawn(consume_one(empty, sum, finished));
+loop.spawn(consume_one(empty, sum, finished));
+loop.run();
+EXPECT_EQ(results, std::vector<bool>{true});
+EXPECT_EQ(finished, 0);
+
+full.close();
+empty.close();
+loop.run();
+EXPECT_EQ(results, (std::vector<bool>{true, false, false}));
+EXPECT_EQ(finished, 2);
+EXPECT_EQ(sum, 0);
+EXPECT_EQ(full.try_pop(), 0);
+int value = 1;
+EXPECT_FALSE(full.try_push(value));
+}
+
+TEST(AsyncChannelTest, ThousandsOfConsumersShareOneLoop) {
+EventLoop loop;
+Channel channel(16, loop);
+constexpr int consumers = 5000;
+long long sum = 0;
+int finished = 0;
+for (int i = 0; i < consumers; ++i) {
+loop.spawn(consume_one(channel, sum, finished));
+}
+std::vector<bool> results;
+loop.spawn(produce(channel, 1, consumers, results));
+loop.run();
+EXPECT_EQ(finished, consumers);
+EXPECT_EQ(sum, static_cast<long long>(consumers) * (consumers + 1) / 2);
+EXPECT_TRUE(channel.try_pop() == std::nullopt);
+}
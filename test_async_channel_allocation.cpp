@@ -0,0 +1,92 @@
+#include "async_channel.hpp"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <optional>
+#include <vector>
+
+namespace {
+
+std::atomic<std::size_t> allocations{0};
+
+using Channel = AsyncChannel<int, EventLoop>;
+
+AsyncTask consume(Channel& channel, std::vector<int>& received) {
+    while (std::optional<int> value = co_await channel.pop()) {
+        received.push_back(*value);
+    }
+}
+
+AsyncTask ping_pong(Channel& input, Channel& output, int rounds) {
+    for (int i = 0; i < rounds; ++i) {
+        std::optional<int> value = co_await input.pop();
+        co_await output.push(*value + 1);
+    }
+}
+
+}
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* address = std::malloc(size == 0 ? 1 : size)) {
+        return address;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept {
+    return operator new(size, tag);
+}
+
+void operator delete(void* address) noexcept {
+    std::free(address);
+}
+
+void operator delete(void* address, std::size_t) noexcept {
+    operator delete(address);
+}
+
+void operator delete[](void* address) noexcept {
+    operator delete(address);
+}
+
+void operator delete[](void* address, std::size_t) noexcept {
+    operator delete(address);
+}
+
+
+TEST(AsyncChannelAllocationTest, ResumptionDoesNotAllocate) {
+EventLoop loop;
+Channel requests(1, loop);
+Channel responses(1, loop);
+constexpr int rounds = 1000;
+std::vector<int> received;
+received.reserve(rounds + 1);
+loop.spawn(ping_pong(requests, responses, rounds));
+loop.spawn(consume(responses, received));
+loop.run();
+
+const std::size_t before = allocations.load();
+for (int i = 0; i < rounds; ++i) {
+int value = i;
+ASSERT_TRUE(requests.try_push(value));
+loop.run();
+}
+EXPECT_EQ(allocations.load(), before);
+ASSERT_EQ(received.size(), static_cast<std::size_t>(rounds));
+EXPECT_EQ(received.front(), 1);
+EXPECT_EQ(received.back(), rounds);
+
+responses.close();
+loop.run();
+}
@@ -0,0 +1,158 @@
+#include "blocking_circular_buffer.hpp"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+TEST(BlockingCircularBufferTest, TryPushAndPop) {
+BlockingCircularBuffer<std::string> buffer(2);
+EXPECT_EQ(buffer.capacity(), 2);
+EXPECT_TRUE(buffer.try_push("a"));
+EXPECT_TRUE(buffer.try_push("b"));
+EXPECT_FALSE(buffer.try_push("c"));
+EXPECT_EQ(buffer.size(), 2);
+
+std::string value;
+EXPECT_TRUE(buffer.pop_wait(value));
+EXPECT_EQ(value, "a");
+EXPECT_TRUE(buffer.try_pop(value));
+EXPECT_EQ(value, "b");
+EXPECT_FALSE(buffer.try_pop(value));
+EXPECT_TRUE(buffer.empty());
+}
+
+TEST(BlockingCircularBufferTest, TimedOperationsTimeOut) {
+using namespace std::chrono_literals;
+BlockingCircularBuffer<int> buffer(1);
+int value = 0;
+
+auto start = std::chrono::steady_clock::now();
+EXPECT_FALSE(buffer.try_pop_for(value, 20ms));
+EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+EXPECT_TRUE(buffer.try_push_for(1, 20ms));
+start = std::chrono::steady_clock::now();
+EXPECT_FALSE(buffer.try_push_for(2, 20ms));
+EXPECT_GE(std::chrono::steady_clock::now() - start, 20ms);
+
+EXPECT_TRUE(buffer.try_pop_for(value, 20ms));
+EXPECT_EQ(value, 1);
+}
+
+TEST(BlockingCircularBufferTest, PushWaitBlocksUntilSpaceIsFreed) {
+BlockingCircularBuffer<int> buffer(1);
+EXPECT_TRUE(buffer.push_wait(1));
+
+std::atomic<bool> pushed{false};
+std::thread producer([&] {
+EXPECT_TRUE(buffer.push_wait(2));
+pushed = true;
+});
+
+std::this_thread::sleep_for(std::chrono::milliseconds(20));
+EXPECT_FALSE(pushed.load());
+int value = 0;
+EXPECT_TRUE(buffer.pop_wait(value));
+EXPECT_EQ(value, 1);
+producer.join();
+EXPECT_TRUE(pushed.load());
+EXPECT_TRUE(buffer.pop_wait(value));
+EXPECT_EQ(value, 2);
+}
+
+TEST(BlockingCircularBufferTest, CloseWakesWaitersAndDrains) {
+BlockingCircularBuffer<int> buffer(4);
+std::vector<std::thread> consumers;
+std::atomic<int> finished{0};
+for (int i = 0; i < 3; ++i) {
+consumers.emplace_back([&] {
+int value = 0;
+EXPECT_FALSE(buffer.pop_wait(value));
+++finished;
+});
+}
+
+std::this_thread::sleep_for(std::chrono::milliseconds(20));
+EXPECT_EQ(finished.load(), 0);
+buffer.close();
+for (auto& consumer : consumers) {
+consumer.join();
+}
+EXPECT_EQ(finished.load(), 3);
+EXPECT_TRUE(buffer.closed());
+EXPECT_FALSE(buffer.push_wait(1));
+
+BlockingCircularBuffer<int> draining(4);
+EXPECT_TRUE(draining.try_push(7));
+draining.close();
+int value = 0;
+EXPECT_TRUE(draining.pop_wait(value));
+EXPECT_EQ(value, 7);
+EXPECT_FALSE(draining.pop_wait(value));
+}
+
+TEST(BlockingCircularBufferTest, MultipleProducersAndConsumers) {
+BlockingCircularBuffer<int> buffer(8);
+const int producers = 3;
+const int consumers = 3;
+const int per_producer = 20000;
+std::atomic<long long> sum{0};
+std::atomic<int> consumed{0};
+
+std::vector<std::thread> threads;
+for (int p = 0; p < producers; ++p) {
+threads.emplace_back([&buffer, p] {
+for (int i = 1; i <= per_producer; ++i) {
+EXPECT_TRUE(buffer.push_wait(p * per_producer + i));
+}
+});
+}
+for (int c = 0; c < consumers; ++c) {
+threads.emplace_back([&] {
+int value = 0;
+while (buffer.pop_wait(value)) {
+sum += value;
+++consumed;
+}
+});
+}
+for (int p = 0; p < producers; ++p) {
+threads[p].join();
+}
+buffer.close();
+for (int c = 0; c < consumers; ++c) {
+threads[producers + c].join();
+}
+
+const long long total = static_cast<long long>(producers) * per_producer;
+EXPECT_EQ(consumed.load(), total);
+EXPECT_EQ(sum.load(), total * (total + 1) / 2);
+}
+
+TEST(BlockingCircularBufferTest, BatchPushWakesConsumers) {
+BlockingCircularBuffer<int> buffer(16);
+std::atomic<int> received{0};
+std::vector<std::thread> consumers;
+for (int i = 0; i < 4; ++i) {
+consumers.emplace_back([&] {
+int value = 0;
+while (buffer.pop_wait(value)) {
+++received;
+}
+});
+}
+
+const int values[] = {1, 2, 3, 4, 5, 6, 7, 8};
+EXPECT_EQ(buffer.try_push_batch(values, 8), 8u);
+while (received.load() < 8) {
+std::this_thread::yield();
+}
+buffer.close();
+for (auto& consumer : consumers) {
+consumer.join();
+}
+EXPECT_EQ(received.load(), 8);
+}
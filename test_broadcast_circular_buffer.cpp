@@ -0,0 +1,141 @@
+#include "broadcast_circular_buffer.hpp"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct Message {
+        std::uint64_t sequence;
+        std::uint64_t check;
+        std::uint64_t padding[6];
+    };
+
+    Message make_message(std::uint64_t sequence) {
+        Message message{sequence, sequence * 7 + 3, {}};
+        for (auto& word : message.padding) {
+            word = sequence;
+        }
+        return message;
+    }
+
+}
+
+
+TEST(BroadcastCircularBufferTest, EveryReaderSeesEveryValue) {
+BroadcastCircularBuffer<int> ring(8, 3);
+auto first = ring.subscribe();
+auto second = ring.subscribe();
+EXPECT_EQ(ring.reader_count(), 2u);
+for (int i = 0; i < 5; ++i) {
+ring.publish(i);
+}
+
+std::vector<int> a;
+std::vector<int> b;
+EXPECT_EQ(first.read_batch(std::back_inserter(a), 100), 5u);
+EXPECT_EQ(second.read_batch(std::back_inserter(b), 3), 3u);
+EXPECT_EQ(a, (std::vector<int>{0, 1, 2, 3, 4}));
+EXPECT_EQ(b, (std::vector<int>{0, 1, 2}));
+int value = 0;
+EXPECT_FALSE(first.try_read(value));
+EXPECT_EQ(first.lag(), 0u);
+EXPECT_EQ(second.lag(), 2u);
+
+auto late = ring.subscribe();
+EXPECT_FALSE(late.try_read(value));
+ring.publish(5);
+EXPECT_TRUE(late.try_read(value));
+EXPECT_EQ(value, 5);
+}
+
+TEST(BroadcastCircularBufferTest, LappedReaderSkipsAheadAndCountsLoss) {
+BroadcastCircularBuffer<int> ring(4, 2);
+auto reader = ring.subscribe();
+const std::vector<int> values{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+EXPECT_EQ(ring.publish_range(values.begin(), values.end()), 10u);
+EXPECT_EQ(ring.published(), 10u);
+
+std::vector<int> seen;
+reader.read_batch(std::back_inserter(seen), 100);
+EXPECT_EQ(seen, (std::vector<int>{7, 8, 9}));
+EXPECT_EQ(reader.lost(), 7u);
+EXPECT_EQ(reader.position(), 10u);
+}
+
+TEST(BroadcastCircularBufferTest, LagReportAndReaderSlots) {
+BroadcastCircularBuffer<int> ring(16, 2);
+auto fast = ring.subscribe();
+{
+auto slow = ring.subscribe();
+EXPECT_THROW((void)ring.subscribe(), std::runtime_error);
+for (int i = 0; i < 10; ++i) {
+ring.publish(i);
+}
+int value = 0;
+while (fast.try_read(value)) {
+}
+const auto report = ring.lag_report();
+ASSERT_EQ(report.size(), 2u);
+EXPECT_EQ(report[0].reader, slow.id());
+EXPECT_EQ(report[0].lag, 10u);
+EXPECT_EQ(report[1].lag, 0u);
+EXPECT_EQ(ring.lag_report(5).size(), 1u);
+}
+EXPECT_EQ(ring.reader_count(), 1u);
+auto replacement = ring.subscribe();
+EXPECT_EQ(replacement.lag(), 0u);
+
+auto moved = std::move(replacement);
+EXPECT_EQ(ring.reader_count(), 2u);
+EXPECT_THROW(BroadcastCircularBuffer<int>(0), std::invalid_argument);
+EXPECT_THROW(BroadcastCircularBuffer<int>(4, 0), std::invalid_argument);
+}
+
+TEST(BroadcastCircularBufferTest, ConcurrentReadersNeverSeeTornValues) {
+constexpr std::uint64_t total = 200000;
+BroadcastCircularBuffer<Message> ring(64, 4);
+std::vector<BroadcastCircularBuffer<Message>::Reader> readers;
+for (int i = 0; i < 3; ++i) {
+readers.push_back(ring.subscribe());
+}
+std::atomic<bool> done{false};
+std::atomic<int> failures{0};
+
+std::vector<std::thread> threads;
+for (auto& reader : readers) {
+threads.emplace_back([&reader, &done, &failures] {
+Message message{};
+std::uint64_t next = 0;
+std::uint64_t received = 0;
+for (;;) {
+const bool finished = done.load(std::memory_order_acquire);
+while (reader.try_read(message)) {
+bool valid = message.check == message.sequence * 7 + 3 && message.sequence >= next;
+for (auto word : message.padding) {
+valid = valid && word == message.sequence;
+}
+failures += valid ? 0 : 1;
+next = message.sequence + 1;
+++received;
+}
+if (finished) {
+break;
+}
+std::this_thread::yield();
+}
+failures += received + reader.lost() == total ? 0 : 1;
+});
+}
+for (std::uint64_t i = 0; i < total; ++i) {
+ring.publish(make_message(i));
+}
+done.store(true, std::memory_order_release);
+for (auto& thread : threads) {
+thread.join();
+}
+EXPECT_EQ(failures.load(), 0);
+}
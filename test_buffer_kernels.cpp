@@ -0,0 +1,150 @@
+#include "buffer_kernels.hpp"
+#include "circular_buffer.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+namespace {
+
+template<typename T>
+CircularBuffer<T> make_wrapped(std::size_t capacity, std::size_t count, int seed) {
+    CircularBuffer<T> buffer(capacity);
+    for (std::size_t i = 0; i < capacity / 3 + count; ++i) {
+        buffer.push(static_cast<T>(static_cast<int>((i * 37 + static_cast<std::size_t>(seed)) % 101) - 50));
+    }
+    buffer.pop_n(buffer.size() - std::min(buffer.size(), count));
+    return buffer;
+}
+
+class IsaGuard {
+public:
+    IsaGuard() : saved_(BufferKernels::active_isa()) {}
+    ~IsaGuard() { BufferKernels::select_isa(saved_); }
+
+private:
+    SimdIsa saved_;
+};
+
+template<typename T>
+void check_reductions() {
+    IsaGuard guard;
+    for (SimdIsa isa : {SimdIsa::scalar, SimdIsa::avx2, SimdIsa::avx512}) {
+        BufferKernels::select_isa(isa);
+        for (std::size_t count : {1u, 7u, 64u, 131u, 1000u}) {
+            const auto buffer = make_wrapped<T>(1024, count, 3);
+            const auto other = make_wrapped<T>(1500, count, 11);
+            const std::vector<T> values(buffer.begin(), buffer.end());
+            const std::vector<T> others(other.begin(), other.end());
+
+            T sum{};
+            T dot{};
+            std::size_t above = 0;
+            for (std::size_t i = 0; i < values.size(); ++i) {
+                sum = static_cast<T>(sum + values[i]);
+                dot = static_cast<T>(dot + values[i] * others[i]);
+                above += values[i] > T(10) ? 1 : 0;
+            }
+            EXPECT_EQ(BufferKernels::sum(buffer), sum);
+            EXPECT_EQ(BufferKernels::dot(buffer, other), dot);
+            EXPECT_EQ(BufferKernels::count_if(buffer, T(10)), above);
+            EXPECT_EQ(BufferKernels::count_if(buffer, T(10), std::less_equal<>()), values.size() - above);
+
+            const auto [low, high] = BufferKernels::minmax(buffer);
+            EXPECT_EQ(low, *std::min_element(values.begin(), values.end()));
+            EXPECT_EQ(high, *std::max_element(values.begin(), values.end()));
+        }
+    }
+}
+
+}
+
+
+TEST(BufferKernelsTest, SelectIsaClampsToSupported) {
+IsaGuard guard;
+EXPECT_EQ(BufferKernels::select_isa(SimdIsa::scalar), SimdIsa::scalar);
+EXPECT_EQ(BufferKernels::active_isa(), SimdIsa::scalar);
+EXPECT_EQ(BufferKernels::select_isa(SimdIsa::avx512), BufferKernels::supported_isa());
+}
+
+TEST(BufferKernelsTest, ReductionsMatchIteratorLoop) {
+check_reductions<int>();
+check_reductions<std::int64_t>();
+check_reductions<std::int16_t>();
+check_reductions<float>();
+check_reductions<double>();
+}
+
+TEST(BufferKernelsTest, CountHandlesLongRunsOfNarrowLanes) {
+IsaGuard guard;
+CircularBuffer<std::int8_t> buffer(100000);
+for (int i = 0; i < 130000; ++i) {
+buffer.push(static_cast<std::int8_t>(i % 3 == 0 ? 5 : -5));
+}
+std::size_t expected = 0;
+for (std::int8_t value : buffer) {
+expected += value > 0 ? 1 : 0;
+}
+for (SimdIsa isa : {SimdIsa::scalar, SimdIsa::avx2, SimdIsa::avx512}) {
+BufferKernels::select_isa(isa);
+EXPECT_EQ(BufferKernels::count_if(buffer, std::int8_t(0)), expected);
+}
+}
+
+TEST(BufferKernelsTest, CountAcceptsCustomPredicates) {
+IsaGuard guard;
+const auto buffer = make_wrapped<double>(300, 257, 4);
+const auto above = [](double value, double threshold) { return value > threshold; };
+const auto near = [](double value, double threshold) { return value - threshold < 3 && threshold - value < 3; };
+std::size_t expected_above = 0;
+std::size_t expected_near = 0;
+for (double value : buffer) {
+expected_above += above(value, 5.0) ? 1 : 0;
+expected_near += near(value, 5.0) ? 1 : 0;
+}
+ASSERT_GT(expected_above, 0u);
+ASSERT_GT(expected_near, 0u);
+for (SimdIsa isa : {SimdIsa::scalar, SimdIsa::avx2, SimdIsa::avx512}) {
+BufferKernels::select_isa(isa);
+EXPECT_EQ(BufferKernels::count_if(buffer, 5.0, above), expected_above);
+EXPECT_EQ(BufferKernels::count_if(buffer, 5.0, near), expected_near);
+EXPECT_EQ(BufferKernels::count_if(buffer, 5.0, std::greater<>()), expected_above);
+}
+}
+
+TEST(BufferKernelsTest, TransformAndAxpyAcrossSegments) {
+IsaGuard guard;
+for (SimdIsa isa : {SimdIsa::scalar, SimdIsa::avx2, SimdIsa::avx512}) {
+BufferKernels::select_isa(isa);
+auto x = make_wrapped<double>(300, 257, 1);
+auto y = make_wrapped<double>(500, 257, 2);
+std::vector<double> expected_x(x.begin(), x.end());
+std::vector<double> expected_y(y.begin(), y.end());
+
+BufferKernels::transform(x, 2.0, 1.0);
+for (double& value : expected_x) {
+value = value * 2.0 + 1.0;
+}
+EXPECT_EQ(std::vector<double>(x.begin(), x.end()), expected_x);
+
+BufferKernels::axpy(0.5, x, y);
+for (std::size_t i = 0; i < expected_y.size(); ++i) {
+expected_y[i] += 0.5 * expected_x[i];
+}
+EXPECT_EQ(std::vector<double>(y.begin(), y.end()), expected_y);
+}
+}
+
+TEST(BufferKernelsTest, RejectsInvalidInput) {
+CircularBuffer<int> empty(4);
+CircularBuffer<int> x(4);
+CircularBuffer<int> y(4);
+x.push(1);
+EXPECT_EQ(BufferKernels::sum(empty), 0);
+EXPECT_EQ(BufferKernels::count_if(empty, 0), 0u);
+EXPECT_THROW(BufferKernels::minmax(empty), std::runtime_error);
+EXPECT_THROW(BufferKernels::dot(x, y), std::invalid_argument);
+EXPECT_THROW(BufferKernels::axpy(1, x, y), std::invalid_argument);
+}
@@ -1,207 +1,1134 @@
-#include "circular_buffer.hpp"
-#include "gtest/gtest.h"
-#include <fstream>
-#include <cstdio>
-
-
-TEST(CircularBufferTest, Constructor) {
-CircularBuffer<int> buffer(5);
-
-EXPECT_EQ(buffer.capacity(), 5);
-EXPECT_TRUE(buffer.empty());
-EXPECT_FALSE(buffer.full());
-EXPECT_EQ(buffer.size(), 0);
-}
-
-TEST(CircularBufferTest, PushAndSize) {
-CircularBuffer<int> buffer(3);
-
-buffer.push(1);
-EXPECT_EQ(buffer.size(), 1);
-EXPECT_EQ(buffer.front(), 1);
-
-buffer.push(2);
-buffer.push(3);
-EXPECT_EQ(buffer.size(), 3);
-EXPECT_TRUE(buffer.full());
-}
-
-TEST(CircularBufferTest, OverflowBehavior) {
-CircularBuffer<int> buffer(3);
-
-buffer.push(1);
-buffer.push(2);
-buffer.push(3);
-buffer.push(4);
-
-EXPECT_TRUE(buffer.full());
-EXPECT_EQ(buffer.size(), 3);
-EXPECT_EQ(buffer.front(), 2);
-
-EXPECT_EQ(buffer[0], 2);
-EXPECT_EQ(buffer[1], 3);
-EXPECT_EQ(buffer[2], 4);
-}
-
-TEST(CircularBufferTest, Pop) {
-CircularBuffer<int> buffer(3);
-
-buffer.push(10);
-buffer.push(20);
-buffer.push(30);
-
-buffer.pop();
-EXPECT_EQ(buffer.size(), 2);
-EXPECT_EQ(buffer.front(), 20);
-
-buffer.pop();
-EXPECT_EQ(buffer.size(), 1);
-EXPECT_EQ(buffer.front(), 30);
-}
-
-TEST(CircularBufferTest, RandomAccess) {
-CircularBuffer<int> buffer(5);
-
-for (int i = 0; i < 5; ++i) {
-buffer.push(i * 10);
-}
-
-EXPECT_EQ(buffer[0], 0);
-EXPECT_EQ(buffer[2], 20);
-EXPECT_EQ(buffer[4], 40);
-}
-
-TEST(CircularBufferTest, Clear) {
-CircularBuffer<int> buffer(5);
-
-for (int i = 0; i < 5; ++i) {
-buffer.push(i);
-}
-
-buffer.clear();
-EXPECT_TRUE(buffer.empty());
-EXPECT_FALSE(buffer.full());
-EXPECT_EQ(buffer.size(), 0);
-}
-
-TEST(CircularBufferTest, Iterator) {
-CircularBuffer<int> buffer(4);
-
-buffer.push(10);
-buffer.push(20);
-buffer.push(30);
-
-int sum = 0;
-for (int val : buffer) {
-sum += val;
-}
-EXPECT_EQ(sum, 60);
-}
-
-TEST(CircularBufferTest, CopyConstructor) {
-CircularBuffer<int> buffer1(3);
-buffer1.push(100);
-buffer1.push(200);
-
-CircularBuffer<int> buffer2 = buffer1;
-
-EXPECT_EQ(buffer2.size(), 2);
-EXPECT_EQ(buffer2.capacity(), 3);
-EXPECT_EQ(buffer2.front(), 100);
-EXPECT_EQ(buffer2[1], 200);
-}
-
-TEST(CircularBufferTest, MoveConstructor) {
-CircularBuffer<int> buffer1(3);
-buffer1.push(50);
-buffer1.push(60);
-
-CircularBuffer<int> buffer2 = std::move(buffer1);
-
-EXPECT_EQ(buffer2.size(), 2);
-EXPECT_EQ(buffer2.front(), 50);
-EXPECT_TRUE(buffer1.empty());
-}
-
-TEST(CircularBufferTest, Resize) {
-CircularBuffer<int> buffer(3);
-buffer.push(1);
-buffer.push(2);
-
-buffer.resize(5);
-EXPECT_EQ(buffer.capacity(), 5);
-EXPECT_EQ(buffer.size(), 2);
-EXPECT_EQ(buffer.front(), 1);
-EXPECT_EQ(buffer[1], 2);
-
-buffer.resize(2);
-EXPECT_EQ(buffer.capacity(), 2);
-EXPECT_EQ(buffer.size(), 2);
-}
-
-TEST(CircularBufferTest, EmplaceWithPair) {
-CircularBuffer<std::pair<int, std::string>> buffer(2);
-buffer.emplace(1, "One");
-buffer.emplace(2, "Two");
-
-EXPECT_EQ(buffer.front().first, 1);
-EXPECT_EQ(buffer.front().second, "One");
-EXPECT_EQ(buffer.back().first, 2);
-EXPECT_EQ(buffer.back().second, "Two");
-}
-
-TEST(CircularBufferTest, FileOperationsBinary) {
-CircularBuffer<int> buffer1(5);
-for (int i = 1; i <= 5; ++i) {
-buffer1.push(i * 10);
-}
-
-const std::string filename = "test_binary.bin";
-buffer1.saveToFile(filename);
-
-CircularBuffer<int> buffer2(1);
-buffer2.loadFromFile(filename);
-
-EXPECT_EQ(buffer2.capacity(), 5);
-EXPECT_EQ(buffer2.size(), 5);
-EXPECT_EQ(buffer2[0], 10);
-EXPECT_EQ(buffer2[4], 50);
-
-std::remove(filename.c_str());
-}
-
-TEST(CircularBufferTest, FileOperationsText) {
-CircularBuffer<int> buffer1(3);
-buffer1.push(100);
-buffer1.push(200);
-buffer1.push(300);
-
-const std::string filename = "test_text.txt";
-buffer1.saveToTextFile(filename);
-
-CircularBuffer<int> buffer2(1);
-buffer2.loadFromTextFile(filename);
-
-EXPECT_EQ(buffer2.capacity(), 3);
-EXPECT_EQ(buffer2.size(), 3);
-EXPECT_EQ(buffer2.front(), 100);
-EXPECT_EQ(buffer2.back(), 300);
-
-std::remove(filename.c_str());
-}
-
-TEST(CircularBufferTest, EdgeCases) {
-CircularBuffer<int> single_buffer(1);
-single_buffer.push(42);
-EXPECT_TRUE(single_buffer.full());
-EXPECT_EQ(single_buffer.front(), 42);
-
-single_buffer.push(99);
-EXPECT_EQ(single_buffer.front(), 99);
-}
-
-
-int main(int argc, char **argv) {
-    ::testing::InitGoogleTest(&argc, argv);
-    return RUN_ALL_TESTS();
+#include "circular_buffer.hpp"
+#include "gtest/gtest.h"
+#include <fstream>
+#include <algorithm>
+#include <cstdio>
+#include <iterator>
+#include <memory_resource>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+TEST(CircularBufferTest, Constructor) {
+CircularBuffer<int> buffer(5);
+
+EXPECT_EQ(buffer.capacity(), 5);
+EXPECT_TRUE(buffer.empty());
+EXPECT_FALSE(buffer.full());
+EXPECT_EQ(buffer.size(), 0);
+}
+
+TEST(CircularBufferTest, PushAndSize) {
+CircularBuffer<int> buffer(3);
+
+buffer.push(1);
+EXPECT_EQ(buffer.size(), 1);
+EXPECT_EQ(buffer.front(), 1);
+
+buffer.push(2);
+buffer.push(3);
+EXPECT_EQ(buffer.size(), 3);
+EXPECT_TRUE(buffer.full());
+}
+
+TEST(CircularBufferTest, OverflowBehavior) {
+CircularBuffer<int> buffer(3);
+
+buffer.push(1);
+buffer.push(2);
+buffer.push(3);
+buffer.push(4);
+
+EXPECT_TRUE(buffer.full());
+EXPECT_EQ(buffer.size(), 3);
+EXPECT_EQ(buffer.front(), 2);
+
+EXPECT_EQ(buffer[0], 2);
+EXPECT_EQ(buffer[1], 3);
+EXPECT_EQ(buffer[2], 4);
+}
+
+TEST(CircularBufferTest, Pop) {
+CircularBuffer<int> buffer(3);
+
+buffer.push(10);
+buffer.push(20);
+buffer.push(30);
+
+buffer.pop();
+EXPECT_EQ(buffer.size(), 2);
+EXPECT_EQ(buffer.front(), 20);
+
+buffer.pop();
+EXPECT_EQ(buffer.size(), 1);
+EXPECT_EQ(buffer.front(), 30);
+}
+
+TEST(CircularBufferTest, RandomAccess) {
+CircularBuffer<int> buffer(5);
+
+for (int i = 0; i < 5; ++i) {
+buffer.push(i * 10);
+}
+
+EXPECT_EQ(buffer[0], 0);
+EXPECT_EQ(buffer[2], 20);
+EXPECT_EQ(buffer[4], 40);
+}
+
+TEST(CircularBufferTest, Clear) {
+CircularBuffer<int> buffer(5);
+
+for (int i = 0; i < 5; ++i) {
+buffer.push(i);
+}
+
+buffer.clear();
+EXPECT_TRUE(buffer.empty());
+EXPECT_FALSE(buffer.full());
+EXPECT_EQ(buffer.size(), 0);
+}
+
+TEST(CircularBufferTest, Iterator) {
+CircularBuffer<int> buffer(4);
+
+buffer.push(10);
+buffer.push(20);
+buffer.push(30);
+
+int sum = 0;
+for (int val : buffer) {
+sum += val;
+}
+EXPECT_EQ(sum, 60);
+}
+
+TEST(CircularBufferTest, CopyConstructor) {
+CircularBuffer<int> buffer1(3);
+buffer1.push(100);
+buffer1.push(200);
+
+CircularBuffer<int> buffer2 = buffer1;
+
+EXPECT_EQ(buffer2.size(), 2);
+EXPECT_EQ(buffer2.capacity(), 3);
+EXPECT_EQ(buffer2.front(), 100);
+EXPECT_EQ(buffer2[1], 200);
+}
+
+TEST(CircularBufferTest, MoveConstructor) {
+CircularBuffer<int> buffer1(3);
+buffer1.push(50);
+buffer1.push(60);
+
+CircularBuffer<int> buffer2 = std::move(buffer1);
+
+EXPECT_EQ(buffer2.size(), 2);
+EXPECT_EQ(buffer2.front(), 50);
+EXPECT_TRUE(buffer1.empty());
+}
+
+TEST(CircularBufferTest, Resize) {
+CircularBuffer<int> buffer(3);
+buffer.push(1);
+buffer.push(2);
+
+buffer.resize(5);
+EXPECT_EQ(buffer.capacity(), 5);
+EXPECT_EQ(buffer.size(), 2);
+EXPECT_EQ(buffer.front(), 1);
+EXPECT_EQ(buffer[1], 2);
+
+buffer.resize(2);
+EXPECT_EQ(buffer.capacity(), 2);
+EXPECT_EQ(buffer.size(), 2);
+}
+
+TEST(CircularBufferTest, EmplaceWithPair) {
+CircularBuffer<std::pair<int, std::string>> buffer(2);
+buffer.emplace(1, "One");
+buffer.emplace(2, "Two");
+
+EXPECT_EQ(buffer.front().first, 1);
+EXPECT_EQ(buffer.front().second, "One");
+EXPECT_EQ(buffer.back().first, 2);
+EXPECT_EQ(buffer.back().second, "Two");
+}
+
+TEST(CircularBufferTest, FileOperationsBinary) {
+CircularBuffer<int> buffer1(5);
+for (int i = 1; i <= 5; ++i) {
+buffer1.push(i * 10);
+}
+
+const std::string filename = "test_binary.bin";
+buffer1.saveToFile(filename);
+
+CircularBuffer<int> buffer2(1);
+buffer2.loadFromFile(filename);
+
+EXPECT_EQ(buffer2.capacity(), 5);
+EXPECT_EQ(buffer2.size(), 5);
+EXPECT_EQ(buffer2[0], 10);
+EXPECT_EQ(buffer2[4], 50);
+
+std::remove(filename.c_str());
+}
+
+TEST(CircularBufferTest, FileOperationsText) {
+CircularBuffer<int> buffer1(3);
+buffer1.push(100);
+buffer1.push(200);
+buffer1.push(300);
+
+const std::string filename = "test_text.txt";
+buffer1.saveToTextFile(filename);
+
+CircularBuffer<int> buffer2(1);
+buffer2.loadFromTextFile(filename);
+
+EXPECT_EQ(buffer2.capacity(), 3);
+EXPECT_EQ(buffer2.size(), 3);
+EXPECT_EQ(buffer2.front(), 100);
+EXPECT_EQ(buffer2.back(), 300);
+
+std::remove(filename.c_str());
+}
+
+TEST(CircularBufferTest, EdgeCases) {
+CircularBuffer<int> single_buffer(1);
+single_buffer.push(42);
+EXPECT_TRUE(single_buffer.full());
+EXPECT_EQ(single_buffer.front(), 42);
+
+single_buffer.push(99);
+EXPECT_EQ(single_buffer.front(), 99);
+}
+
+
+struct Tracked {
+static int constructions;
+static int destructions;
+
+explicit Tracked(int v) : value(v) { ++constructions; }
+Tracked(const Tracked& other) : value(other.value) { ++constructions; }
+Tracked(Tracked&& other) noexcept : value(other.value) { ++constructions; }
+Tracked& operator=(const Tracked&) = default;
+Tracked& operator=(Tracked&&) noexcept = default;
+~Tracked() { ++destructions; }
+
+int value;
+};
+
+int Tracked::constructions = 0;
+int Tracked::destructions = 0;
+
+TEST(CircularBufferTest, LazyConstructionAndDestruction) {
+Tracked::constructions = 0;
+Tracked::destructions = 0;
+{
+CircularBuffer<Tracked> buffer(1000);
+EXPECT_EQ(Tracked::constructions, 0);
+
+buffer.emplace(1);
+buffer.emplace(2);
+EXPECT_EQ(Tracked::constructions, 2);
+EXPECT_EQ(buffer.front().value, 1);
+
+buffer.pop();
+EXPECT_EQ(Tracked::destructions, 1);
+
+CircularBuffer<Tracked> copy = buffer;
+EXPECT_EQ(Tracked::constructions, 3);
+EXPECT_EQ(copy.front().value, 2);
+}
+EXPECT_EQ(Tracked::constructions, Tracked::destructions);
+}
+
+TEST(CircularBufferTest, OverwriteAndClearDestroyElements) {
+Tracked::constructions = 0;
+Tracked::destructions = 0;
+{
+CircularBuffer<Tracked> buffer(2);
+for (int i = 0; i < 5; ++i) {
+buffer.emplace(i);
+}
+EXPECT_EQ(buffer.front().value, 3);
+EXPECT_EQ(buffer.back().value, 4);
+EXPECT_EQ(Tracked::constructions - Tracked::destructions, 2);
+
+buffer.resize(4);
+EXPECT_EQ(Tracked::constructions - Tracked::destructions, 2);
+EXPECT_EQ(buffer[1].value, 4);
+
+buffer.clear();
+EXPECT_EQ(Tracked::constructions, Tracked::destructions);
+}
+EXPECT_EQ(Tracked::constructions, Tracked::destructions);
+}
+
+TEST(CircularBufferTest, ResizeShrinkToFullKeepsHeadInRange) {
+CircularBuffer<int> buffer(4);
+buffer.push(1);
+buffer.push(2);
+buffer.push(3);
+
+buffer.resize(2);
+buffer.push(4);
+EXPECT_EQ(buffer.size(), 2);
+EXPECT_EQ(buffer.front(), 2);
+EXPECT_EQ(buffer.back(), 4);
+}
+
+TEST(CircularBufferTest, PowerOfTwoCapacityRoundsUp) {
+CircularBuffer<int, PowerOfTwoCapacity> buffer(5);
+EXPECT_EQ(buffer.capacity(), 8);
+
+CircularBuffer<int, PowerOfTwoCapacity> exact(16);
+EXPECT_EQ(exact.capacity(), 16);
+
+EXPECT_THROW((CircularBuffer<int, PowerOfTwoCapacity>(0)), std::invalid_argument);
+}
+
+TEST(CircularBufferTest, PowerOfTwoOverflowAndAccess) {
+CircularBuffer<int, PowerOfTwoCapacity> buffer(4);
+
+for (int i = 0; i < 11; ++i) {
+buffer.push(i);
+}
+
+EXPECT_TRUE(buffer.full());
+EXPECT_EQ(buffer.size(), 4);
+EXPECT_EQ(buffer.front(), 7);
+EXPECT_EQ(buffer.back(), 10);
+EXPECT_EQ(buffer[1], 8);
+EXPECT_THROW(buffer[4], std::out_of_range);
+
+int expected = 7;
+for (int val : buffer) {
+EXPECT_EQ(val, expected++);
+}
+
+buffer.pop();
+buffer.pop();
+EXPECT_EQ(buffer.size(), 2);
+EXPECT_EQ(buffer.front(), 9);
+
+buffer.clear();
+EXPECT_TRUE(buffer.empty());
+}
+
+TEST(CircularBufferTest, PowerOfTwoResizeAndFile) {
+CircularBuffer<int, PowerOfTwoCapacity> buffer(4);
+for (int i = 1; i <= 6; ++i) {
+buffer.push(i * 10);
+}
+
+buffer.resize(5);
+EXPECT_EQ(buffer.capacity(), 8);
+EXPECT_EQ(buffer.size(), 4);
+EXPECT_EQ(buffer.front(), 30);
+EXPECT_EQ(buffer.back(), 60);
+
+const std::string filename = "test_pow2.bin";
+buffer.saveToFile(filename);
+
+CircularBuffer<int, PowerOfTwoCapacity> loaded(1);
+loaded.loadFromFile(filename);
+EXPECT_EQ(loaded.capacity(), 8);
+EXPECT_EQ(loaded.size(), 4);
+EXPECT_EQ(loaded.front(), 30);
+EXPECT_EQ(loaded.back(), 60);
+
+std::remove(filename.c_str());
+}
+
+TEST(CircularBufferTest, PushRangeWrapsAndOverwrites) {
+CircularBuffer<int> buffer(5);
+buffer.push(1);
+buffer.push(2);
+buffer.push(3);
+buffer.pop();
+buffer.pop();
+
+std::vector<int> values{4, 5, 6, 7};
+buffer.push_range(values.begin(), values.end());
+EXPECT_EQ(buffer.size(), 5);
+EXPECT_EQ(buffer.front(), 3);
+EXPECT_EQ(buffer.back(), 7);
+
+int more[] = {8, 9};
+buffer.push_range(std::begin(more), std::end(more));
+EXPECT_EQ(buffer.size(), 5);
+EXPECT_EQ(buffer[0], 5);
+EXPECT_EQ(buffer[4], 9);
+
+std::vector<int> many(12);
+std::iota(many.begin(), many.end(), 100);
+buffer.push_range(many.begin(), many.end());
+EXPECT_EQ(buffer.size(), 5);
+EXPECT_EQ(buffer.front(), 107);
+EXPECT_EQ(buffer.back(), 111);
+}
+
+TEST(CircularBufferTest, PushRangeFromInputIterator) {
+CircularBuffer<int> buffer(3);
+std::istringstream input("1 2 3 4");
+
+buffer.push_range(std::istream_iterator<int>(input), std::istream_iterator<int>());
+EXPECT_EQ(buffer.size(), 3);
+EXPECT_EQ(buffer.front(), 2);
+EXPECT_EQ(buffer.back(), 4);
+}
+
+TEST(CircularBufferTest, PopNAndPopInto) {
+CircularBuffer<std::string> buffer(4);
+for (const char* word : {"a", "b", "c", "d", "e", "f"}) {
+buffer.push(word);
+}
+
+EXPECT_EQ(buffer.pop_n(1), 1);
+EXPECT_EQ(buffer.front(), "d");
+
+std::vector<std::string> out;
+buffer.pop_into(std::back_inserter(out), 10);
+EXPECT_EQ(out, (std::vector<std::string>{"d", "e", "f"}));
+EXPECT_TRUE(buffer.empty());
+EXPECT_EQ(buffer.pop_n(3), 0);
+}
+
+TEST(CircularBufferTest, WriteAndRead) {
+CircularBuffer<int, PowerOfTwoCapacity> buffer(8);
+int input[6] = {1, 2, 3, 4, 5, 6};
+int output[8] = {};
+
+buffer.write(input, 6);
+EXPECT_EQ(buffer.read(output, 4), 4);
+EXPECT_EQ(output[3], 4);
+
+buffer.write(input, 6);
+EXPECT_EQ(buffer.size(), 8);
+EXPECT_EQ(buffer.read(output, 8), 8);
+EXPECT_EQ(output[0], 5);
+EXPECT_EQ(output[1], 6);
+EXPECT_EQ(output[2], 1);
+EXPECT_EQ(output[7], 6);
+EXPECT_EQ(buffer.read(output, 8), 0);
+}
+
+TEST(CircularBufferTest, ArrayRanges) {
+CircularBuffer<int> buffer(5);
+EXPECT_EQ(buffer.array_one().second, 0);
+EXPECT_EQ(buffer.array_two().second, 0);
+
+for (int i = 1; i <= 7; ++i) {
+buffer.push(i);
+}
+
+const auto one = buffer.array_one();
+const auto two = buffer.array_two();
+ASSERT_EQ(one.second, 3);
+ASSERT_EQ(two.second, 2);
+EXPECT_EQ(one.first[0], 3);
+EXPECT_EQ(one.first[2], 5);
+EXPECT_EQ(two.first[0], 6);
+EXPECT_EQ(two.first[1], 7);
+EXPECT_FALSE(buffer.is_linearized());
+
+const CircularBuffer<int>& view = buffer;
+EXPECT_EQ(view.array_one().second + view.array_two().second, view.size());
+}
+
+TEST(CircularBufferTest, LinearizeFullBuffer) {
+CircularBuffer<int> buffer(5);
+for (int i = 1; i <= 7; ++i) {
+buffer.push(i);
+}
+
+int* data = buffer.linearize();
+EXPECT_TRUE(buffer.is_linearized());
+for (int i = 0; i < 5; ++i) {
+EXPECT_EQ(data[i], i + 3);
+}
+EXPECT_EQ(buffer.array_one().second, 5);
+
+buffer.push(8);
+EXPECT_EQ(buffer.front(), 4);
+EXPECT_EQ(buffer.back(), 8);
+}
+
+TEST(CircularBufferTest, LinearizePartialBufferWithStrings) {
+CircularBuffer<std::string, PowerOfTwoCapacity> buffer(8);
+for (int i = 0; i < 10; ++i) {
+buffer.push(std::to_string(i));
+}
+buffer.pop_n(3);
+
+std::string* data = buffer.linearize();
+ASSERT_EQ(buffer.size(), 5);
+EXPECT_EQ(data, buffer.array_one().first);
+for (int i = 0; i < 5; ++i) {
+EXPECT_EQ(data[i], std::to_string(i + 5));
+}
+
+buffer.push("x");
+EXPECT_EQ(buffer.back(), "x");
+EXPECT_EQ(buffer.front(), "5");
+}
+
+TEST(CircularBufferTest, LinearizeKeepsContiguousDataInPlace) {
+CircularBuffer<int> buffer(6);
+for (int i = 0; i < 4; ++i) {
+buffer.push(i);
+}
+buffer.pop();
+
+int* data = buffer.linearize();
+EXPECT_EQ(data, &buffer.front());
+EXPECT_EQ(data[0], 1);
+EXPECT_EQ(buffer.array_one().second, 3);
+}
+
+TEST(CircularBufferTest, RandomAccessIterator) {
+CircularBuffer<int> buffer(5);
+for (int i = 1; i <= 7; ++i) {
+buffer.push(i * 10);
+}
+
+static_assert(std::is_same_v<std::iterator_traits<CircularBuffer<int>::iterator>::iterator_category,
+std::random_access_iterator_tag>);
+
+auto it = buffer.begin();
+EXPECT_EQ(*(it + 3), 60);
+EXPECT_EQ(it[4], 70);
+EXPECT_EQ(buffer.end() - buffer.begin(), 5);
+
+std::advance(it, 4);
+EXPECT_EQ(*it, 70);
+--it;
+EXPECT_EQ(*it, 60);
+EXPECT_EQ(*(it - 3), 30);
+EXPECT_TRUE(buffer.begin() < it);
+EXPECT_TRUE(buffer.end() >= it);
+}
+
+TEST(CircularBufferTest, IteratorAlgorithms) {
+CircularBuffer<int> buffer(6);
+for (int value : {9, 4, 7, 1, 8, 2, 6, 3}) {
+buffer.push(value);
+}
+
+std::sort(buffer.begin(), buffer.end());
+EXPECT_EQ(std::vector<int>(buffer.begin(), buffer.end()), (std::vector<int>{1, 2, 3, 6, 7, 8}));
+EXPECT_EQ(buffer.front(), 1);
+
+const auto found = std::lower_bound(buffer.cbegin(), buffer.cend(), 6);
+EXPECT_EQ(found - buffer.cbegin(), 3);
+
+std::reverse(buffer.begin(), buffer.end());
+EXPECT_EQ(buffer.back(), 1);
+}
+
+TEST(CircularBufferTest, IteratorToConstIterator) {
+CircularBuffer<int> buffer(3);
+buffer.push(1);
+buffer.push(2);
+
+CircularBuffer<int>::const_iterator cit = buffer.begin();
+EXPECT_TRUE(cit == buffer.begin());
+EXPECT_TRUE(buffer.begin() == cit);
+EXPECT_TRUE(buffer.end() != cit);
+EXPECT_EQ(buffer.end() - cit, 2);
+EXPECT_FALSE((std::is_convertible_v<CircularBuffer<int>::const_iterator, CircularBuffer<int>::iterator>));
+}
+
+TEST(CircularBufferTest, IteratorContiguousSize) {
+CircularBuffer<int> buffer(4);
+for (int i = 0; i < 6; ++i) {
+buffer.push(i);
+}
+
+auto it = buffer.begin();
+ASSERT_EQ(it.contiguous_size(), 2);
+EXPECT_EQ(&*it + 1, &*(it + 1));
+
+it += static_cast<std::ptrdiff_t>(it.contiguous_size());
+EXPECT_EQ(*it, 4);
+EXPECT_EQ(it.contiguous_size(), 2);
+EXPECT_EQ(&*it + 1, &*(it + 1));
+EXPECT_EQ((it + 1).contiguous_size(), 1);
+EXPECT_EQ(buffer.end().contiguous_size(), 0);
+EXPECT_EQ((buffer.cbegin() + 3).contiguous_size(), 1);
+}
+
+TEST(CircularBufferTest, MirroredStorageIsContiguousAcrossWrap) {
+const std::size_t capacity = MirroredMemory::page_size();
+CircularBuffer<char> buffer(capacity, MirroredStorage{});
+if (!buffer.is_mirrored()) {
+GTEST_SKIP() << "mirrored mappings are not available";
+}
+
+std::vector<char> data(capacity - 10, 'a');
+buffer.write(data.data(), data.size());
+buffer.pop_n(data.size() - 5);
+
+const char tail[] = "0123456789abcdef";
+buffer.write(tail, 16);
+ASSERT_EQ(buffer.size(), 21);
+EXPECT_TRUE(buffer.is_linearized());
+EXPECT_EQ(buffer.array_two().second, 0);
+
+const auto [first, length] = buffer.array_one();
+ASSERT_EQ(length, 21);
+EXPECT_EQ(std::string(first, length), std::string(5, 'a') + "0123456789abcdef");
+EXPECT_EQ(buffer.linearize(), first);
+
+char out[21];
+EXPECT_EQ(buffer.read(out, 21), 21);
+EXPECT_EQ(std::string(out + 5, 16), "0123456789abcdef");
+}
+
+TEST(CircularBufferTest, MirroredStorageCopyMoveAndResize) {
+const std::size_t capacity = MirroredMemory::page_size() / sizeof(int);
+CircularBuffer<int> buffer(capacity, MirroredStorage{});
+for (std::size_t i = 0; i < capacity + 3; ++i) {
+buffer.push(static_cast<int>(i));
+}
+
+CircularBuffer<int> copy = buffer;
+EXPECT_EQ(copy.is_mirrored(), buffer.is_mirrored());
+EXPECT_EQ(copy.front(), 3);
+EXPECT_EQ(copy.back(), static_cast<int>(capacity + 2));
+
+CircularBuffer<int> moved = std::move(copy);
+EXPECT_EQ(moved.array_one().second + moved.array_two().second, capacity);
+
+moved.resize(capacity + 1);
+EXPECT_FALSE(moved.is_mirrored());
+EXPECT_EQ(moved.front(), 3);
+EXPECT_EQ(moved.size(), capacity);
+}
+
+TEST(CircularBufferTest, MirroredStorageFallsBack) {
+CircularBuffer<char> odd_size(100, MirroredStorage{});
+EXPECT_FALSE(odd_size.is_mirrored());
+
+CircularBuffer<std::string> non_trivial(MirroredMemory::page_size(), MirroredStorage{});
+EXPECT_FALSE(non_trivial.is_mirrored());
+non_trivial.push("x");
+EXPECT_EQ(non_trivial.front(), "x");
+}
+
+TEST(CircularBufferTest, SnapshotRoundTrip) {
+CircularBuffer<int> buffer(5);
+for (int i = 1; i <= 8; ++i) {
+buffer.push(i);
+}
+
+const std::string filename = "test_snapshot.bin";
+buffer.saveSnapshot(filename);
+
+CircularBuffer<int> loaded(1);
+loaded.loadSnapshot(filename);
+EXPECT_EQ(loaded.capacity(), 5);
+EXPECT_EQ(std::vector<int>(loaded.begin(), loaded.end()), (std::vector<int>{4, 5, 6, 7, 8}));
+
+std::remove(filename.c_str());
+}
+
+TEST(CircularBufferTest, SnapshotWithSerializer) {
+CircularBuffer<std::string> buffer(3);
+buffer.push("alpha");
+buffer.push("");
+buffer.push("gamma");
+buffer.push("delta");
+
+const std::string filename = "test_snapshot_strings.bin";
+buffer.saveSnapshot(filename);
+
+CircularBuffer<std::string> loaded(1);
+loaded.loadSnapshot(filename);
+EXPECT_EQ(loaded.size(), 3);
+EXPECT_EQ(loaded[0], "");
+EXPECT_EQ(loaded[1], "gamma");
+EXPECT_EQ(loaded[2], "delta");
+
+std::remove(filename.c_str());
+}
+
+TEST(CircularBufferTest, SnapshotRejectsCorruptFiles) {
+CircularBuffer<int> buffer(4);
+buffer.push(1);
+buffer.push(2);
+
+const std::string filename = "test_snapshot_corrupt.bin";
+buffer.saveSnapshot(filename);
+
+CircularBuffer<int> target(2);
+target.push(42);
+
+{
+std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+file.seekp(-1, std::ios::end);
+file.put('\x7f');
+}
+EXPECT_THROW(target.loadSnapshot(filename), std::runtime_error);
+EXPECT_EQ(target.size(), 1);
+EXPECT_EQ(target.front(), 42);
+
+buffer.saveSnapshot(filename);
+{
+std::ifstream in(filename, std::ios::binary);
+std::string contents((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+out.write(contents.data(), static_cast<std::streamsize>(contents.size() - 2));
+}
+EXPECT_THROW(target.loadSnapshot(filename), std::runtime_error);
+
+buffer.saveSnapshot(filename);
+CircularBuffer<double> wrong_type(1);
+EXPECT_THROW(wrong_type.loadSnapshot(filename), std::runtime_error);
+
+std::remove(filename.c_str());
+}
+
+TEST(CircularBufferTest, LoadFromFileRejectsInvalidHeader) {
+const std::string filename = "test_binary_invalid.bin";
+{
+std::ofstream file(filename, std::ios::binary);
+const std::size_t header[4] = {4, 9, 0, 0};
+file.write(reinterpret_cast<const char*>(header), sizeof(header));
+}
+
+CircularBuffer<int> buffer(1);
+EXPECT_THROW(buffer.loadFromFile(filename), std::runtime_error);
+
+std::remove(filename.c_str());
+}
+
+TEST(CircularBufferTest, TextFileRoundTripsDoublesExactly) {
+CircularBuffer<double> buffer1(4);
+for (double value : {0.1, -2.5e-300, 1.0 / 3.0, 6.02214076e23, 7.0}) {
+buffer1.push(value);
+}
+
+const std::string filename = "test_text_double.txt";
+buffer1.saveToTextFile(filename);
+
+CircularBuffer<double> buffer2(1);
+buffer2.loadFromTextFile(filename);
+
+EXPECT_EQ(buffer2.capacity(), 4);
+ASSERT_EQ(buffer2.size(), 4);
+EXPECT_EQ(buffer2[0], -2.5e-300);
+EXPECT_EQ(buffer2[1], 1.0 / 3.0);
+EXPECT_EQ(buffer2[2], 6.02214076e23);
+EXPECT_EQ(buffer2[3], 7.0);
+
+std::remove(filename.c_str());
+}
+
+TEST(CircularBufferTest, TextFileReadsStreamFormattedFile) {
+const std::string filename = "test_text_stream.txt";
+{
+std::ofstream file(filename);
+file << 5 << " " << 3 << " " << 1 << " " << 3 << "\n";
+file << -7 << " " << 42 << " " << 1000000 << " " << "\n";
+}
+
+CircularBuffer<long> buffer(1);
+buffer.loadFromTextFile(filename);
+
+EXPECT_EQ(buffer.capacity(), 5);
+ASSERT_EQ(buffer.size(), 3);
+EXPECT_EQ(buffer[0], -7);
+EXPECT_EQ(buffer[1], 42);
+EXPECT_EQ(buffer[2], 1000000);
+buffer.push(8);
+EXPECT_EQ(buffer.back(), 8);
+
+std::remove(filename.c_str());
+}
+
+TEST(CircularBufferTest, TextFileRejectsMalformedInput) {
+const std::string filename = "test_text_malformed.txt";
+{
+std::ofstream file(filename);
+file << "4 3 3 0\n1 2 x \n";
+}
+
+CircularBuffer<int> buffer(1);
+EXPECT_THROW(buffer.loadFromTextFile(filename), std::runtime_error);
+
+{
+std::ofstream file(filename);
+file << "4 9 0 0\n";
+}
+EXPECT_THROW(buffer.loadFromTextFile(filename), std::runtime_error);
+
+std::remove(filename.c_str());
+}
+
+struct AllocatorStats {
+int allocations = 0;
+int live = 0;
+std::size_t bytes = 0;
+};
+
+template<typename T, bool Propagate>
+struct TaggedAllocator {
+using value_type = T;
+using propagate_on_container_copy_assignment = std::bool_constant<Propagate>;
+using propagate_on_container_move_assignment = std::bool_constant<Propagate>;
+using is_always_equal = std::false_type;
+
+TaggedAllocator(int tag, AllocatorStats* stats) : tag(tag), stats(stats) {}
+template<typename U>
+TaggedAllocator(const TaggedAllocator<U, Propagate>& other) : tag(other.tag), stats(other.stats) {}
+
+T* allocate(std::size_t count) {
+++stats->allocations;
+++stats->live;
+stats->bytes += count * sizeof(T);
+return std::allocator<T>().allocate(count);
+}
+
+void deallocate(T* pointer, std::size_t count) {
+--stats->live;
+stats->bytes -= count * sizeof(T);
+std::allocator<T>().deallocate(pointer, count);
+}
+
+friend bool operator==(const TaggedAllocator& lhs, const TaggedAllocator& rhs) { return lhs.tag == rhs.tag; }
+friend bool operator!=(const TaggedAllocator& lhs, const TaggedAllocator& rhs) { return lhs.tag != rhs.tag; }
+
+int tag;
+AllocatorStats* stats;
+};
+
+TEST(CircularBufferTest, AllocatorIsUsedForStorage) {
+AllocatorStats stats;
+using Allocator = TaggedAllocator<std::string, false>;
+{
+CircularBuffer<std::string, ModuloCapacity, Allocator> buffer(4, Allocator(1, &stats));
+EXPECT_EQ(stats.allocations, 1);
+buffer.push("one");
+buffer.push("two");
+buffer.resize(8);
+EXPECT_EQ(stats.allocations, 2);
+EXPECT_EQ(stats.live, 1);
+EXPECT_EQ(buffer.get_allocator().tag, 1);
+EXPECT_EQ(buffer.front(), "one");
+}
+EXPECT_EQ(stats.live, 0);
+}
+
+TEST(CircularBufferTest, AllocatorCopyAssignmentPropagation) {
+AllocatorStats stats;
+using Keep = TaggedAllocator<int, false>;
+using Propagate = TaggedAllocator<int, true>;
+
+CircularBuffer<int, ModuloCapacity, Keep> keep_source({1, 2, 3}, Keep(1, &stats));
+CircularBuffer<int, ModuloCapacity, Keep> keep_target(2, Keep(2, &stats));
+keep_target = keep_source;
+EXPECT_EQ(keep_target.get_allocator().tag, 2);
+EXPECT_EQ(keep_target.back(), 3);
+
+CircularBuffer<int, ModuloCapacity, Propagate> propagate_source({1, 2, 3}, Propagate(3, &stats));
+CircularBuffer<int, ModuloCapacity, Propagate> propagate_target(2, Propagate(4, &stats));
+propagate_target = propagate_source;
+EXPECT_EQ(propagate_target.get_allocator().tag, 3);
+EXPECT_EQ(propagate_target.size(), 3);
+
+CircularBuffer<int, ModuloCapacity, Keep> copy(keep_source);
+EXPECT_EQ(copy.get_allocator().tag, 1);
+}
+
+TEST(CircularBufferTest, AllocatorMoveAssignmentWithUnequalAllocators) {
+AllocatorStats stats;
+using Allocator = TaggedAllocator<std::string, false>;
+{
+CircularBuffer<std::string, ModuloCapacity, Allocator> source(3, Allocator(1, &stats));
+source.push("a");
+source.push("b");
+source.push("c");
+source.push("d");
+
+CircularBuffer<std::string, ModuloCapacity, Allocator> target(1, Allocator(2, &stats));
+target = std::move(source);
+EXPECT_EQ(target.get_allocator().tag, 2);
+ASSERT_EQ(target.size(), 3);
+EXPECT_EQ(target[0], "b");
+EXPECT_EQ(target[2], "d");
+
+CircularBuffer<std::string, ModuloCapacity, Allocator> same(1, Allocator(2, &stats));
+const int allocations = stats.allocations;
+same = std::move(target);
+EXPECT_EQ(stats.allocations, allocations);
+EXPECT_EQ(same.back(), "d");
+}
+EXPECT_EQ(stats.live, 0);
+}
+
+TEST(CircularBufferTest, PmrBufferUsesArena) {
+alignas(std::max_align_t) static unsigned char storage[1 << 16];
+std::pmr::monotonic_buffer_resource arena(storage, sizeof(storage), std::pmr::null_memory_resource());
+
+pmr::CircularBuffer<std::pmr::string> buffer(4, &arena);
+for (int i = 0; i < 6; ++i) {
+buffer.emplace(std::string(40, static_cast<char>('a' + i)));
+}
+EXPECT_EQ(buffer.get_allocator().resource(), &arena);
+EXPECT_EQ(buffer.front().get_allocator().resource(), &arena);
+EXPECT_EQ(buffer.front(), std::pmr::string(40, 'c'));
+
+pmr::CircularBuffer<std::pmr::string> copy(buffer);
+EXPECT_NE(copy.get_allocator().resource(), &arena);
+copy.resize(8);
+EXPECT_EQ(copy.back(), std::pmr::string(40, 'f'));
+}
+
+TEST(CircularBufferTest, ResizeShrinksAndGrowsInPlace) {
+CircularBuffer<int> buffer(8);
+for (int i = 0; i < 11; ++i) {
+buffer.push(i);
+}
+const int* storage = std::min(buffer.array_one().first, buffer.array_two().first);
+
+buffer.resize(5);
+EXPECT_EQ(buffer.capacity(), 5);
+ASSERT_EQ(buffer.size(), 5);
+EXPECT_EQ(buffer.array_one().first, storage);
+for (int i = 0; i < 5; ++i) {
+EXPECT_EQ(buffer[i], i + 3);
+}
+buffer.push(100);
+EXPECT_EQ(buffer.front(), 4);
+EXPECT_EQ(buffer.back(), 100);
+
+buffer.resize(8);
+EXPECT_EQ(buffer.capacity(), 8);
+EXPECT_GE(buffer.array_one().first, storage);
+EXPECT_LT(buffer.array_one().first, storage + 8);
+buffer.push(101);
+buffer.push(102);
+buffer.push(103);
+EXPECT_TRUE(buffer.full());
+EXPECT_EQ(buffer.front(), 4);
+EXPECT_EQ(buffer.back(), 103);
+}
+
+TEST(CircularBufferTest, ResizeInPlaceDestroysTruncatedElements) {
+Tracked::constructions = 0;
+Tracked::destructions = 0;
+{
+CircularBuffer<Tracked, PowerOfTwoCapacity> buffer(8);
+for (int i = 0; i < 13; ++i) {
+buffer.emplace(i);
+}
+buffer.resize(4);
+EXPECT_EQ(buffer.capacity(), 4);
+ASSERT_EQ(buffer.size(), 4);
+EXPECT_EQ(buffer.front().value, 5);
+EXPECT_EQ(buffer.back().value, 8);
+EXPECT_EQ(Tracked::constructions - Tracked::destructions, 4);
+
+buffer.resize(8);
+buffer.emplace(20);
+EXPECT_EQ(buffer.size(), 5);
+EXPECT_EQ(buffer.back().value, 20);
+}
+EXPECT_EQ(Tracked::constructions, Tracked::destructions);
+}
+
+TEST(CircularBufferTest, CopyAssignmentReusesStorage) {
+CircularBuffer<std::string> source(6);
+for (int i = 0; i < 9; ++i) {
+source.push(std::to_string(i));
+}
+
+CircularBuffer<std::string> target(6);
+target.push("stale");
+const std::string* storage = target.array_one().first;
+target = source;
+EXPECT_EQ(target.array_one().first, storage);
+EXPECT_TRUE(target.is_linearized());
+ASSERT_EQ(target.size(), 6);
+EXPECT_TRUE(std::equal(target.begin(), target.end(), source.begin(), source.end()));
+
+CircularBuffer<std::string> smaller(3);
+smaller.push("x");
+smaller = source;
+EXPECT_EQ(smaller.capacity(), 6);
+EXPECT_EQ(smaller.back(), "8");
+
+target.resize(2);
+target = source;
+EXPECT_EQ(target.array_one().first, storage);
+EXPECT_EQ(target.capacity(), 6);
+EXPECT_EQ(target.front(), "3");
+}
+
+TEST(CircularBufferTest, ShrinkReleasesStorage) {
+AllocatorStats stats;
+using Allocator = TaggedAllocator<int, false>;
+CircularBuffer<int, ModuloCapacity, Allocator> buffer(1024, Allocator(1, &stats));
+for (int i = 0; i < 1500; ++i) {
+buffer.push(i);
+}
+
+buffer.resize(512);
+EXPECT_EQ(stats.allocations, 1);
+EXPECT_EQ(stats.bytes, 1024 * sizeof(int));
+buffer.shrink_to_fit();
+EXPECT_EQ(stats.allocations, 2);
+EXPECT_EQ(stats.live, 1);
+EXPECT_EQ(stats.bytes, 512 * sizeof(int));
+EXPECT_EQ(buffer.front(), 476);
+EXPECT_EQ(buffer.back(), 987);
+
+buffer.resize(100);
+EXPECT_EQ(stats.allocations, 3);
+EXPECT_EQ(stats.bytes, 100 * sizeof(int));
+EXPECT_EQ(buffer.front(), 476);
+EXPECT_EQ(buffer.back(), 575);
+buffer.shrink_to_fit();
+EXPECT_EQ(stats.allocations, 3);
+EXPECT_EQ(buffer.size(), 100);
+}
+
+TEST(CircularBufferTest, CopyKeepsOverflowCount) {
+CircularBuffer<int> source(3);
+for (int i = 0; i < 7; ++i) {
+source.push(i);
+}
+ASSERT_EQ(source.overflow_count(), 4u);
+
+CircularBuffer<int> copy(source);
+EXPECT_EQ(copy.overflow_count(), 4u);
+CircularBuffer<int> target(3);
+target.push(1);
+target = source;
+EXPECT_EQ(target.overflow_count(), 4u);
+CircularBuffer<int> larger(8);
+larger = source;
+EXPECT_EQ(larger.overflow_count(), 4u);
+}
+
+TEST(CircularBufferTest, CopyFromMovedFromBuffer) {
+CircularBuffer<std::string> source({"a", "b"});
+CircularBuffer<std::string> moved(std::move(source));
+
+CircularBuffer<std::string> copy(source);
+EXPECT_TRUE(copy.empty());
+EXPECT_EQ(copy.capacity(), 0u);
+
+CircularBuffer<std::string> target({"x", "y", "z"});
+target = source;
+EXPECT_TRUE(target.empty());
+EXPECT_EQ(target.capacity(), 0u);
+
+target = moved;
+EXPECT_EQ(target.size(), 2u);
+EXPECT_EQ(target.front(), "a");
+}
+
+TEST(CircularBufferTest, OverwritePolicyCountsEvictions) {
+CircularBuffer<int> buffer(3);
+EXPECT_TRUE(buffer.push(1));
+EXPECT_TRUE(buffer.push(2));
+EXPECT_TRUE(buffer.push(3));
+EXPECT_EQ(buffer.overflow_count(), 0u);
+
+EXPECT_TRUE(buffer.push(4));
+EXPECT_TRUE(buffer.emplace(5));
+EXPECT_EQ(buffer.overflow_count(), 2u);
+EXPECT_EQ(buffer.front(), 3);
+
+const std::vector<int> values = {6, 7, 8, 9};
+EXPECT_EQ(buffer.push_range(values.begin(), values.end()), 4u);
+EXPECT_EQ(buffer.overflow_count(), 6u);
+EXPECT_EQ(buffer.front(), 7);
+EXPECT_EQ(buffer.back(), 9);
+}
+
+TEST(CircularBufferTest, RejectPolicyKeepsExistingElements) {
+CircularBuffer<std::string, ModuloCapacity, std::allocator<std::string>, RejectNewest> buffer(2);
+EXPECT_TRUE(buffer.push("a"));
+EXPECT_TRUE(buffer.emplace(1, 'b'));
+std::string value = "c";
+EXPECT_FALSE(buffer.push(std::move(value)));
+EXPECT_EQ(value, "c");
+EXPECT_FALSE(buffer.emplace("d"));
+EXPECT_EQ(buffer.front(), "a");
+EXPECT_EQ(buffer.back(), "b");
+EXPECT_EQ(buffer.overflow_count(), 0u);
+
+buffer.pop();
+const std::vector<std::string> values = {"e", "f", "g"};
+EXPECT_EQ(buffer.push_range(values.begin(), values.end()), 1u);
+EXPECT_EQ(buffer.back(), "e");
+}
+
+TEST(CircularBufferTest, DropPolicyCountsDroppedElements) {
+CircularBuffer<int, PowerOfTwoCapacity, std::allocator<int>, DropNewest> buffer(4);
+for (int i = 0; i < 6; ++i) {
+buffer.push(i);
+}
+EXPECT_EQ(buffer.overflow_count(), 2u);
+EXPECT_EQ(buffer.front(), 0);
+EXPECT_EQ(buffer.back(), 3);
+
+buffer.pop_n(2);
+const int values[] = {10, 11, 12, 13, 14};
+EXPECT_EQ(buffer.write(values, 5), 2u);
+EXPECT_EQ(buffer.overflow_count(), 5u);
+ASSERT_EQ(buffer.size(), 4u);
+EXPECT_EQ(buffer[2], 10);
+EXPECT_EQ(buffer[3], 11);
+}
+
+TEST(CircularBufferTest, GrowPolicyDoublesCapacity) {
+CircularBuffer<int, ModuloCapacity, std::allocator<int>, GrowCapacity> buffer(3);
+buffer.push(0);
+buffer.push(1);
+buffer.push(2);
+buffer.pop();
+buffer.push(3);
+EXPECT_TRUE(buffer.push(4));
+EXPECT_EQ(buffer.capacity(), 6u);
+ASSERT_EQ(buffer.size(), 4u);
+for (int i = 0; i < 4; ++i) {
+EXPECT_EQ(buffer[i], i + 1);
+}
+
+std::vector<int> values(10);
+std::iota(values.begin(), values.end(), 5);
+EXPECT_EQ(buffer.push_range(values.begin(), values.end()), 10u);
+EXPECT_EQ(buffer.capacity(), 24u);
+EXPECT_EQ(buffer.size(), 14u);
+EXPECT_EQ(buffer.front(), 1);
+EXPECT_EQ(buffer.back(), 14);
+EXPECT_EQ(buffer.overflow_count(), 0u);
+}
+
+TEST(CircularBufferTest, GrowPolicyPushesOwnElements) {
+CircularBuffer<std::string, ModuloCapacity, std::allocator<std::string>, GrowCapacity> buffer(2);
+buffer.push(std::string(40, 'a'));
+buffer.push(std::string(40, 'b'));
+EXPECT_TRUE(buffer.push(buffer.front()));
+EXPECT_EQ(buffer.size(), 3u);
+EXPECT_TRUE(buffer.emplace(buffer.back()));
+EXPECT_TRUE(buffer.push(std::move(buffer[1])));
+EXPECT_EQ(buffer.size(), 5u);
+EXPECT_EQ(buffer.back(), std::string(40, 'b'));
+EXPECT_EQ(buffer[2], std::string(40, 'a'));
+EXPECT_EQ(buffer[3], std::string(40, 'a'));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
 }
\ No newline at end of file
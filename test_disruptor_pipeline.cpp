@@ -0,0 +1,119 @@
+#include "disruptor_pipeline.hpp"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct Event {
+        std::uint64_t id = 0;
+        std::uint64_t doubled = 0;
+        std::uint64_t total = 0;
+    };
+
+    template<typename WaitStrategy>
+    void run_three_stages(std::uint64_t count) {
+        DisruptorPipeline<Event, 3, WaitStrategy> pipeline(64);
+        std::vector<std::uint64_t> seen;
+        seen.reserve(count);
+
+        std::thread parse([&] {
+            pipeline.run(0, [](Event& event, std::uint64_t sequence) {
+                EXPECT_EQ(event.id, sequence);
+                event.doubled = event.id * 2;
+            }, 16);
+        });
+        std::thread enrich([&] {
+            pipeline.run(1, [](Event& event) { event.total = event.id + event.doubled; });
+        });
+        std::thread sink([&] {
+            pipeline.run(2, [&seen](Event& event) { seen.push_back(event.total); }, 7);
+        });
+
+        for (std::uint64_t i = 0; i < count;) {
+            if (i % 3 == 0) {
+                i += pipeline.publish_batch(5, [i](Event& event, std::size_t offset) { event.id = i + offset; });
+            } else {
+                pipeline.publish([i](Event& event) { event.id = i; });
+                ++i;
+            }
+        }
+        pipeline.close();
+        parse.join();
+        enrich.join();
+        sink.join();
+
+        ASSERT_EQ(seen.size(), pipeline.published());
+        for (std::size_t i = 0; i < seen.size(); ++i) {
+            EXPECT_EQ(seen[i], 3 * i);
+        }
+        EXPECT_TRUE(pipeline.finished(2));
+        EXPECT_EQ(pipeline.sequence(2), pipeline.published());
+    }
+
+}
+
+
+TEST(DisruptorPipelineTest, StagesRespectUpstreamBarriers) {
+DisruptorPipeline<Event, 2> pipeline(5);
+EXPECT_EQ(pipeline.capacity(), 8u);
+EXPECT_EQ(pipeline.stage_count(), 2u);
+EXPECT_THROW((DisruptorPipeline<Event, 2>(0)), std::invalid_argument);
+EXPECT_THROW((void)pipeline.sequence(2), std::out_of_range);
+
+const auto second = [](Event& event) { event.total = event.doubled + 1; };
+EXPECT_EQ(pipeline.try_process(1, second), 0u);
+EXPECT_EQ(pipeline.publish_batch(4, [](Event& event, std::size_t i) { event.id = i; }), 4u);
+EXPECT_EQ(pipeline.try_process(1, second), 0u);
+EXPECT_EQ(pipeline.try_process(0, [](Event& event) { event.doubled = event.id * 2; }, 3), 3u);
+EXPECT_EQ(pipeline.sequence(0), 3u);
+EXPECT_EQ(pipeline.try_process(1, second), 3u);
+EXPECT_EQ(pipeline.sequence(1), 3u);
+EXPECT_EQ(pipeline.try_process(1, second), 0u);
+EXPECT_EQ(pipeline.try_process(0, [](Event& event) { event.doubled = event.id * 2; }), 1u);
+
+std::vector<std::uint64_t> totals;
+EXPECT_EQ(pipeline.try_process(1, [&totals](Event& event) { totals.push_back(event.doubled + 1); }), 1u);
+EXPECT_EQ(totals, (std::vector<std::uint64_t>{7}));
+}
+
+TEST(DisruptorPipelineTest, ProducerWaitsForLastStage) {
+DisruptorPipeline<int, 2, BusySpinWait> pipeline(4);
+for (int i = 0; i < 4; ++i) {
+EXPECT_TRUE(pipeline.try_publish([i](int& slot) { slot = i; }));
+}
+EXPECT_FALSE(pipeline.try_publish([](int& slot) { slot = -1; }));
+EXPECT_EQ(pipeline.try_process(0, [](int& slot) { slot *= 10; }), 4u);
+EXPECT_FALSE(pipeline.try_publish([](int& slot) { slot = -1; }));
+
+std::vector<int> out;
+EXPECT_EQ(pipeline.try_process(1, [&out](int& slot) { out.push_back(slot); }, 2), 2u);
+EXPECT_TRUE(pipeline.try_publish([](int& slot) { slot = 4; }));
+EXPECT_TRUE(pipeline.try_publish([](int& slot) { slot = 5; }));
+EXPECT_FALSE(pipeline.try_publish([](int& slot) { slot = -1; }));
+EXPECT_EQ(out, (std::vector<int>{0, 10}));
+EXPECT_EQ(pipeline.published(), 6u);
+}
+
+TEST(DisruptorPipelineTest, CloseDrainsAndFinishesStages) {
+DisruptorPipeline<int, 2> pipeline(8);
+pipeline.publish([](int& slot) { slot = 1; });
+pipeline.publish([](int& slot) { slot = 2; });
+pipeline.close();
+EXPECT_FALSE(pipeline.finished(0));
+
+int sum = 0;
+EXPECT_EQ(pipeline.try_process(1, [&sum](int& slot) { sum += slot; }), 0u);
+EXPECT_EQ(pipeline.run(0, [](int& slot) { slot += 100; }), 2u);
+EXPECT_TRUE(pipeline.finished(0));
+EXPECT_EQ(pipeline.run(1, [&sum](int& slot) { sum += slot; }), 2u);
+EXPECT_TRUE(pipeline.finished(1));
+EXPECT_EQ(sum, 203);
+}
+
+TEST(DisruptorPipelineTest, ThreadedStagesWithEachWaitStrategy) {
+run_three_stages<BusySpinWait>(500);
+run_three_stages<YieldingWait>(20000);
+run_three_stages<BlockingWait>(20000);
+}
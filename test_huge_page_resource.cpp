@@ -0,0 +1,52 @@
+#include "huge_page_resource.hpp"
+#include "circular_buffer.hpp"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <cstring>
+
+
+TEST(HugePageResourceTest, MappingSizeRoundsToPageGranularity) {
+const std::size_t page = HugePageResource::page_size();
+EXPECT_EQ(HugePageResource::mapping_size(0), page);
+EXPECT_EQ(HugePageResource::mapping_size(1), page);
+EXPECT_EQ(HugePageResource::mapping_size(page + 1), 2 * page);
+EXPECT_EQ(HugePageResource::mapping_size(HugePageResource::huge_page_size), HugePageResource::huge_page_size);
+EXPECT_EQ(HugePageResource::mapping_size(HugePageResource::huge_page_size + 1), 2 * HugePageResource::huge_page_size);
+}
+
+TEST(HugePageResourceTest, AllocatesAlignedWritableMemory) {
+HugePageResource resource;
+const std::size_t large = 3 * HugePageResource::huge_page_size;
+void* small_block = resource.allocate(100, alignof(std::max_align_t));
+void* large_block = resource.allocate(large, 64);
+
+EXPECT_EQ(reinterpret_cast<std::uintptr_t>(small_block) % HugePageResource::page_size(), 0u);
+EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large_block) % HugePageResource::huge_page_size, 0u);
+std::memset(small_block, 0xAB, 100);
+std::memset(large_block, 0xCD, large);
+EXPECT_EQ(static_cast<unsigned char*>(large_block)[large - 1], 0xCD);
+
+resource.deallocate(large_block, large, 64);
+resource.deallocate(small_block, 100, alignof(std::max_align_t));
+}
+
+TEST(HugePageResourceTest, EqualityIsIdentity) {
+HugePageResource first;
+HugePageResource second(0);
+EXPECT_TRUE(first.is_equal(first));
+EXPECT_FALSE(first.is_equal(second));
+EXPECT_EQ(second.numa_node(), 0);
+}
+
+TEST(HugePageResourceTest, BacksPmrCircularBuffer) {
+HugePageResource resource(0);
+pmr::CircularBuffer<std::uint64_t> buffer(HugePageResource::huge_page_size / sizeof(std::uint64_t), &resource);
+EXPECT_EQ(buffer.get_allocator().resource(), &resource);
+
+for (std::uint64_t i = 0; i < buffer.capacity() + 10; ++i) {
+buffer.push(i);
+}
+EXPECT_TRUE(buffer.full());
+EXPECT_EQ(buffer.front(), 10u);
+EXPECT_EQ(buffer.back(), buffer.capacity() + 9);
+}
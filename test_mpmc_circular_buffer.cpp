@@ -0,0 +1,108 @@
+#include "mpmc_circular_buffer.hpp"
+#include "gtest/gtest.h"
+#include <atomic>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+
+TEST(MpmcCircularBufferTest, Constructor) {
+MpmcCircularBuffer<int> buffer(5);
+
+EXPECT_EQ(buffer.capacity(), 5);
+EXPECT_TRUE(buffer.empty());
+EXPECT_EQ(buffer.size(), 0);
+EXPECT_THROW(MpmcCircularBuffer<int>(0), std::invalid_argument);
+}
+
+TEST(MpmcCircularBufferTest, TryPushTryPop) {
+MpmcCircularBuffer<int> buffer(3);
+int value = 0;
+
+EXPECT_FALSE(buffer.try_pop(value));
+EXPECT_TRUE(buffer.try_push(1));
+EXPECT_TRUE(buffer.try_push(2));
+EXPECT_TRUE(buffer.try_emplace(3));
+EXPECT_FALSE(buffer.try_push(4));
+EXPECT_EQ(buffer.size(), 3);
+
+for (int i = 1; i <= 3; ++i) {
+EXPECT_TRUE(buffer.try_pop(value));
+EXPECT_EQ(value, i);
+}
+EXPECT_TRUE(buffer.empty());
+}
+
+TEST(MpmcCircularBufferTest, SingleSlot) {
+MpmcCircularBuffer<int> buffer(1);
+int value = 0;
+
+for (int i = 0; i < 3; ++i) {
+EXPECT_TRUE(buffer.try_push(i));
+EXPECT_FALSE(buffer.try_push(i + 10));
+EXPECT_EQ(buffer.size(), 1);
+EXPECT_TRUE(buffer.try_pop(value));
+EXPECT_EQ(value, i);
+EXPECT_FALSE(buffer.try_pop(value));
+}
+}
+
+TEST(MpmcCircularBufferTest, BatchClaim) {
+MpmcCircularBuffer<int> buffer(4);
+std::vector<int> input{1, 2, 3, 4, 5, 6};
+
+EXPECT_EQ(buffer.try_push_batch(input.begin(), input.size()), 4);
+EXPECT_EQ(buffer.try_push_batch(input.begin(), 1), 0);
+
+std::vector<int> output(3);
+EXPECT_EQ(buffer.try_pop_batch(output.begin(), 3), 3);
+EXPECT_EQ(output, (std::vector<int>{1, 2, 3}));
+
+EXPECT_EQ(buffer.try_push_batch(input.begin() + 4, 2), 2);
+
+output.assign(5, 0);
+EXPECT_EQ(buffer.try_pop_batch(output.begin(), 5), 3);
+EXPECT_EQ(output, (std::vector<int>{4, 5, 6, 0, 0}));
+}
+
+TEST(MpmcCircularBufferTest, MultipleProducersAndConsumers) {
+MpmcCircularBuffer<int> buffer(64);
+const int producers = 3;
+const int consumers = 3;
+const int per_producer = 20000;
+std::atomic<long long> sum{0};
+std::atomic<int> consumed{0};
+
+std::vector<std::thread> threads;
+for (int p = 0; p < producers; ++p) {
+threads.emplace_back([&buffer, p] {
+for (int i = 1; i <= per_producer; ++i) {
+while (!buffer.try_push(p * per_producer + i)) {
+std::this_thread::yield();
+}
+}
+});
+}
+for (int c = 0; c < consumers; ++c) {
+threads.emplace_back([&] {
+int values[8];
+while (consumed.load() < producers * per_producer) {
+const auto count = buffer.try_pop_batch(values, 8);
+if (count == 0) {
+std::this_thread::yield();
+continue;
+}
+sum += std::accumulate(values, values + count, 0LL);
+consumed += static_cast<int>(count);
+}
+});
+}
+for (auto& thread : threads) {
+thread.join();
+}
+
+const long long total = static_cast<long long>(producers) * per_producer;
+EXPECT_EQ(consumed.load(), total);
+EXPECT_EQ(sum.load(), total * (total + 1) / 2);
+EXPECT_TRUE(buffer.empty());
+}
@@ -0,0 +1,111 @@
+#include "persistent_circular_buffer.hpp"
+#include "gtest/gtest.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+
+namespace {
+
+struct Event {
+long long timestamp;
+double value;
+};
+
+}
+
+TEST(PersistentCircularBufferTest, CreateAndPush) {
+const std::string filename = "test_persistent_create.ring";
+std::remove(filename.c_str());
+{
+PersistentCircularBuffer<int> buffer(filename, 3);
+EXPECT_EQ(buffer.capacity(), 3);
+EXPECT_TRUE(buffer.empty());
+
+buffer.push(1);
+buffer.push(2);
+buffer.push(3);
+buffer.push(4);
+EXPECT_TRUE(buffer.full());
+EXPECT_EQ(buffer.front(), 2);
+EXPECT_EQ(buffer.back(), 4);
+EXPECT_EQ(buffer[1], 3);
+
+buffer.pop();
+EXPECT_EQ(buffer.size(), 2);
+EXPECT_EQ(buffer.front(), 3);
+}
+std::remove(filename.c_str());
+}
+
+TEST(PersistentCircularBufferTest, ReopenRestoresContents) {
+const std::string filename = "test_persistent_reopen.ring";
+std::remove(filename.c_str());
+{
+PersistentCircularBuffer<Event> buffer(filename, 4);
+for (int i = 0; i < 6; ++i) {
+buffer.push(Event{i, i * 0.5});
+}
+buffer.sync();
+}
+{
+PersistentCircularBuffer<Event> buffer(filename, 4);
+ASSERT_EQ(buffer.size(), 4);
+EXPECT_EQ(buffer.front().timestamp, 2);
+EXPECT_EQ(buffer.back().timestamp, 5);
+EXPECT_DOUBLE_EQ(buffer.back().value, 2.5);
+
+const auto one = buffer.array_one();
+const auto two = buffer.array_two();
+EXPECT_EQ(one.second, 2);
+EXPECT_EQ(two.second, 2);
+EXPECT_EQ(two.first[1].timestamp, 5);
+
+buffer.clear();
+}
+{
+PersistentCircularBuffer<Event> buffer(filename, 4);
+EXPECT_TRUE(buffer.empty());
+}
+std::remove(filename.c_str());
+}
+
+TEST(PersistentCircularBufferTest, TornRecordFallsBackToPreviousState) {
+const std::string filename = "test_persistent_torn.ring";
+std::remove(filename.c_str());
+std::uint64_t generation = 0;
+{
+PersistentCircularBuffer<int> buffer(filename, 8);
+buffer.push(10);
+buffer.push(20);
+generation = buffer.generation();
+}
+{
+std::fstream file(filename, std::ios::in | std::ios::out | std::ios::binary);
+const std::streamoff record_size = 32;
+const std::streamoff records_offset = 24;
+file.seekp(records_offset + static_cast<std::streamoff>(generation & 1) * record_size);
+const std::uint64_t garbage = 0xFFFFFFFFFFFFull;
+file.write(reinterpret_cast<const char*>(&garbage), sizeof(garbage));
+}
+{
+PersistentCircularBuffer<int> buffer(filename, 8);
+EXPECT_EQ(buffer.generation(), generation - 1);
+ASSERT_EQ(buffer.size(), 1);
+EXPECT_EQ(buffer.front(), 10);
+}
+std::remove(filename.c_str());
+}
+
+TEST(PersistentCircularBufferTest, RejectsMismatchedFile) {
+const std::string filename = "test_persistent_mismatch.ring";
+std::remove(filename.c_str());
+{
+PersistentCircularBuffer<int> buffer(filename, 8);
+buffer.push(1);
+}
+EXPECT_THROW((PersistentCircularBuffer<int>(filename, 16)), std::runtime_error);
+EXPECT_THROW((PersistentCircularBuffer<double>(filename, 4)), std::runtime_error);
+EXPECT_THROW((PersistentCircularBuffer<int>(filename, 0)), std::invalid_argument);
+std::remove(filename.c_str());
+}
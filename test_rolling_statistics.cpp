@@ -0,0 +1,150 @@
+#include "rolling_statistics.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+struct Gcd {
+    int operator()(int a, int b) const noexcept {
+        while (b != 0) {
+            a = std::exchange(b, a % b);
+        }
+        return a;
+    }
+};
+
+struct Concat {
+    std::string operator()(const std::string& a, const std::string& b) const {
+        return a + b;
+    }
+};
+
+}
+
+
+TEST(RollingStatisticsTest, TracksMomentsAcrossEviction) {
+RollingStatistics<double> stats(3);
+stats.push(1.0);
+stats.push(2.0);
+stats.push(3.0);
+const auto& moments = stats.get<RollingMoments<double>>();
+EXPECT_EQ(moments.count(), 3u);
+EXPECT_DOUBLE_EQ(moments.sum(), 6.0);
+EXPECT_DOUBLE_EQ(moments.mean(), 2.0);
+EXPECT_DOUBLE_EQ(moments.variance(), 1.0);
+
+stats.push(7.0);
+EXPECT_EQ(stats.size(), 3u);
+EXPECT_EQ(moments.count(), 3u);
+EXPECT_DOUBLE_EQ(moments.sum(), 12.0);
+EXPECT_DOUBLE_EQ(moments.mean(), 4.0);
+EXPECT_NEAR(moments.variance(), 7.0, 1e-12);
+EXPECT_NEAR(moments.population_variance(), 14.0 / 3.0, 1e-12);
+
+stats.pop();
+EXPECT_DOUBLE_EQ(moments.mean(), 5.0);
+EXPECT_NEAR(moments.stddev(), std::sqrt(8.0), 1e-12);
+
+stats.clear();
+EXPECT_TRUE(stats.empty());
+EXPECT_EQ(moments.count(), 0u);
+EXPECT_DOUBLE_EQ(moments.mean(), 0.0);
+}
+
+TEST(RollingStatisticsTest, MinMaxFollowsWindow) {
+RollingStatistics<int> stats(3);
+const auto& extremes = stats.get<1>();
+EXPECT_THROW(extremes.min(), std::runtime_error);
+
+for (int value : {5, 1, 4, 4, 9, 2, 2, 2}) {
+stats.push(value);
+}
+EXPECT_EQ(extremes.min(), 2);
+EXPECT_EQ(extremes.max(), 2);
+
+stats.push(8);
+EXPECT_EQ(extremes.min(), 2);
+EXPECT_EQ(extremes.max(), 8);
+
+stats.pop();
+stats.pop();
+EXPECT_EQ(extremes.min(), 8);
+EXPECT_EQ(extremes.max(), 8);
+EXPECT_THROW(RollingStatistics<int>(1).pop(), std::runtime_error);
+}
+
+TEST(RollingStatisticsTest, MatchesRecomputationOverRandomStream) {
+constexpr std::size_t window = 64;
+RollingStatistics<double> stats(window);
+std::mt19937 generator(42);
+std::uniform_real_distribution<double> distribution(-1000.0, 1000.0);
+for (int i = 0; i < 10000; ++i) {
+stats.push(distribution(generator));
+if (i % 7 == 0) {
+stats.pop();
+}
+if (i % 97 != 0 || stats.size() < 2) {
+continue;
+}
+const auto& buffer = stats.window();
+double sum = 0.0;
+for (double value : buffer) {
+sum += value;
+}
+const double mean = sum / static_cast<double>(buffer.size());
+double squares = 0.0;
+for (double value : buffer) {
+squares += (value - mean) * (value - mean);
+}
+const auto& moments = stats.get<RollingMoments<double>>();
+const auto& extremes = stats.get<RollingMinMax<double>>();
+EXPECT_NEAR(moments.sum(), sum, 1e-6);
+EXPECT_NEAR(moments.mean(), mean, 1e-9);
+EXPECT_NEAR(moments.variance(), squares / static_cast<double>(buffer.size() - 1), 1e-6);
+EXPECT_EQ(extremes.min(), *std::min_element(buffer.begin(), buffer.end()));
+EXPECT_EQ(extremes.max(), *std::max_element(buffer.begin(), buffer.end()));
+}
+}
+
+TEST(RollingStatisticsTest, CustomAssociativeAggregate) {
+RollingWindow<int, RollingAggregate<int, Gcd>, RollingAggregate<int, std::plus<int>>> window(3);
+const auto& gcd = window.get<0>();
+const auto& sum = window.get<1>();
+EXPECT_THROW(gcd.value(), std::runtime_error);
+
+window.push(12);
+window.push(18);
+EXPECT_EQ(gcd.value(), 6);
+window.push(8);
+EXPECT_EQ(gcd.value(), 2);
+window.push(30);
+EXPECT_EQ(gcd.value(), 2);
+window.push(45);
+EXPECT_EQ(gcd.value(), 1);
+window.push(60);
+EXPECT_EQ(gcd.value(), 15);
+EXPECT_EQ(sum.value(), 135);
+
+window.pop();
+window.pop();
+EXPECT_EQ(gcd.value(), 60);
+EXPECT_EQ(sum.value(), 60);
+}
+
+TEST(RollingStatisticsTest, CustomAggregatePreservesOrder) {
+RollingWindow<std::string, RollingAggregate<std::string, Concat>> window(3);
+const auto& text = window.get<0>();
+for (const char* part : {"a", "b", "c", "d", "e"}) {
+window.push(part);
+}
+EXPECT_EQ(text.value(), "cde");
+window.pop();
+window.push("f");
+EXPECT_EQ(text.value(), "def");
+}
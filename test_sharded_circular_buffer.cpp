@@ -0,0 +1,136 @@
+#include "sharded_circular_buffer.hpp"
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    struct Event {
+        std::uint64_t timestamp;
+        int producer;
+    };
+
+    template<typename Buffer, typename Function>
+    void run_producers(Buffer& buffer, int producers, Function produce) {
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&buffer, &produce, p] { produce(buffer, p); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+}
+
+
+TEST(ShardedCircularBufferTest, ThreadShardsCollectEveryValue) {
+ShardedCircularBuffer<int> buffer(1000, 4);
+EXPECT_EQ(buffer.capacity(), 4000u);
+run_producers(buffer, 4, [](auto& target, int p) {
+for (int i = 0; i < 1000; ++i) {
+EXPECT_TRUE(target.push(p * 1000 + i));
+}
+});
+EXPECT_EQ(buffer.size(), 4000u);
+EXPECT_EQ(buffer.overflow_count(), 0u);
+
+std::vector<int> drained;
+buffer.drain(std::back_inserter(drained));
+EXPECT_EQ(buffer.size(), 0u);
+std::sort(drained.begin(), drained.end());
+std::vector<int> expected(4000);
+for (int i = 0; i < 4000; ++i) {
+expected[static_cast<std::size_t>(i)] = i;
+}
+EXPECT_EQ(drained, expected);
+}
+
+TEST(ShardedCircularBufferTest, OrderedDrainMergesByTimestamp) {
+ShardedCircularBuffer<Event> buffer(5000, 8);
+std::atomic<std::uint64_t> clock{0};
+run_producers(buffer, 6, [&clock](auto& target, int p) {
+for (int i = 0; i < 2000; ++i) {
+target.push(Event{clock.fetch_add(1), p});
+}
+});
+
+std::vector<Event> drained;
+buffer.drain_ordered(std::back_inserter(drained),
+                     [](const Event& lhs, const Event& rhs) { return lhs.timestamp < rhs.timestamp; });
+ASSERT_EQ(drained.size(), 12000u);
+for (std::size_t i = 0; i < drained.size(); ++i) {
+EXPECT_EQ(drained[i].timestamp, i);
+}
+}
+
+TEST(ShardedCircularBufferTest, OverwriteAccountingPerShard) {
+ShardedCircularBuffer<int> buffer(10, 2);
+const std::size_t shard = buffer.current_shard();
+for (int i = 0; i < 25; ++i) {
+buffer.push(i);
+}
+EXPECT_EQ(buffer.overflow_count(shard), 15u);
+EXPECT_EQ(buffer.overflow_count(1 - shard), 0u);
+EXPECT_EQ(buffer.overflow_count(), 15u);
+EXPECT_THROW((void)buffer.overflow_count(2), std::out_of_range);
+
+std::vector<int> drained;
+buffer.drain(std::back_inserter(drained));
+EXPECT_EQ(drained, (std::vector<int>{15, 16, 17, 18, 19, 20, 21, 22, 23, 24}));
+
+ShardedCircularBuffer<int, RejectNewest> bounded(2, 1);
+EXPECT_TRUE(bounded.push(1));
+EXPECT_TRUE(bounded.emplace(2));
+EXPECT_FALSE(bounded.push(3));
+EXPECT_EQ(bounded.overflow_count(), 0u);
+}
+
+TEST(ShardedCircularBufferTest, CpuSelectionAndValidation) {
+ShardedCircularBuffer<int> buffer(256, 3, ShardSelection::cpu);
+EXPECT_EQ(buffer.selection(), ShardSelection::cpu);
+EXPECT_LT(buffer.current_shard(), 3u);
+run_producers(buffer, 3, [](auto& target, int p) {
+for (int i = 0; i < 50; ++i) {
+target.push(p * 50 + i);
+}
+});
+std::vector<int> drained;
+buffer.drain(std::back_inserter(drained));
+std::sort(drained.begin(), drained.end());
+ASSERT_EQ(drained.size(), 150u);
+EXPECT_EQ(drained.front(), 0);
+EXPECT_EQ(drained.back(), 149);
+EXPECT_EQ(std::adjacent_find(drained.begin(), drained.end()), drained.end());
+
+EXPECT_GE(ShardedCircularBuffer<int>::default_shard_count(), 1u);
+EXPECT_THROW(ShardedCircularBuffer<int>(0, 2), std::invalid_argument);
+EXPECT_THROW(ShardedCircularBuffer<int>(4, 0), std::invalid_argument);
+}
+
+TEST(ShardedCircularBufferTest, ShardIndexFollowsBufferAtReusedAddress) {
+using Buffer = ShardedCircularBuffer<int>;
+alignas(Buffer) unsigned char storage[sizeof(Buffer)];
+bool reused_high_shard = false;
+for (int attempt = 0; attempt < 8 && !reused_high_shard; ++attempt) {
+std::thread([&storage, &reused_high_shard] {
+Buffer* buffer = new (storage) Buffer(4, 8);
+const std::size_t shard = buffer->current_shard();
+EXPECT_TRUE(buffer->push(1));
+buffer->~Buffer();
+
+buffer = new (storage) Buffer(4, 2);
+EXPECT_LT(buffer->current_shard(), 2u);
+EXPECT_TRUE(buffer->push(2));
+EXPECT_EQ(buffer->size(), 1u);
+buffer->~Buffer();
+reused_high_shard = shard >= 2;
+}).join();
+}
+EXPECT_TRUE(reused_high_shard);
+}
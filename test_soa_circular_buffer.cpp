@@ -0,0 +1,147 @@
+#include "soa_circular_buffer.hpp"
+#include "buffer_kernels.hpp"
+#include "gtest/gtest.h"
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace {
+
+    using Ticks = SoACircularBuffer<std::int64_t, double, std::uint32_t>;
+
+    template<typename View>
+    std::vector<typename View::value_type> column_values(const View& view) {
+        std::vector<typename View::value_type> result;
+        const auto [first, second] = view.segments();
+        result.insert(result.end(), first.begin(), first.end());
+        result.insert(result.end(), second.begin(), second.end());
+        return result;
+    }
+
+    struct Throwing {
+        Throwing(int value) : value(value) {}
+        Throwing(const Throwing& other) : value(other.value) {
+            if (value < 0) {
+                throw std::runtime_error("copy failed");
+            }
+        }
+        Throwing& operator=(const Throwing& other) = default;
+
+        int value;
+    };
+
+}
+
+
+TEST(SoACircularBufferTest, RowsAcrossWrap) {
+Ticks ticks(4);
+for (int i = 0; i < 6; ++i) {
+EXPECT_TRUE(ticks.push(i * 10, i * 1.5, static_cast<std::uint32_t>(i)));
+}
+EXPECT_EQ(ticks.size(), 4u);
+EXPECT_EQ(ticks.overflow_count(), 2u);
+EXPECT_EQ(std::get<0>(ticks.front()), 20);
+EXPECT_EQ(std::get<2>(ticks.back()), 5u);
+
+auto [time, price, qty] = ticks[1];
+EXPECT_EQ(time, 30);
+EXPECT_DOUBLE_EQ(price, 4.5);
+price = 100.0;
+qty = 42;
+EXPECT_DOUBLE_EQ(std::get<1>(ticks[1]), 100.0);
+EXPECT_EQ(std::get<2>(ticks[1]), 42u);
+
+std::vector<std::int64_t> times;
+for (const auto& [t, p, q] : std::as_const(ticks)) {
+times.push_back(t);
+}
+EXPECT_EQ(times, (std::vector<std::int64_t>{20, 30, 40, 50}));
+EXPECT_EQ(ticks.end() - ticks.begin(), 4);
+}
+
+TEST(SoACircularBufferTest, ColumnSegmentsAndKernels) {
+SoACircularBuffer<std::int64_t, double> buffer(100);
+for (int i = 0; i < 250; ++i) {
+buffer.push(i, static_cast<double>(i % 17));
+}
+auto prices = buffer.column<1>();
+const auto [first, second] = prices.segments();
+EXPECT_EQ(first.size(), 50u);
+EXPECT_EQ(second.size(), 50u);
+EXPECT_EQ(first.data() + first.size(), second.data() + 100);
+
+const std::vector<double> values = column_values(prices);
+EXPECT_DOUBLE_EQ(BufferKernels::sum(prices), std::accumulate(values.begin(), values.end(), 0.0));
+EXPECT_EQ(BufferKernels::count_if(buffer.column<0>(), std::int64_t(199)), 50u);
+
+BufferKernels::transform(prices, 2.0, 1.0);
+EXPECT_DOUBLE_EQ(std::get<1>(buffer.front()), values.front() * 2.0 + 1.0);
+EXPECT_DOUBLE_EQ(prices[99], values.back() * 2.0 + 1.0);
+EXPECT_THROW(prices[100], std::out_of_range);
+}
+
+TEST(SoACircularBufferTest, OverflowPoliciesAndPop) {
+BasicSoACircularBuffer<RejectNewest, int, std::string> reject(2);
+BasicSoACircularBuffer<DropNewest, int, std::string> drop(2);
+for (int i = 0; i < 4; ++i) {
+EXPECT_EQ(reject.push(i, std::to_string(i)), i < 2);
+EXPECT_EQ(drop.push(i, std::string(40, 'x')), i < 2);
+}
+EXPECT_EQ(reject.overflow_count(), 0u);
+EXPECT_EQ(drop.overflow_count(), 2u);
+
+reject.pop();
+EXPECT_EQ(std::get<1>(reject.front()), "1");
+EXPECT_TRUE(reject.push(7, "seven"));
+EXPECT_EQ(column_values(reject.column<1>()), (std::vector<std::string>{"1", "seven"}));
+EXPECT_EQ(reject.pop_n(5), 2u);
+EXPECT_TRUE(reject.empty());
+EXPECT_THROW(reject.pop(), std::runtime_error);
+EXPECT_THROW(reject.front(), std::runtime_error);
+EXPECT_THROW(reject[0], std::out_of_range);
+EXPECT_THROW(Ticks(0), std::invalid_argument);
+}
+
+TEST(SoACircularBufferTest, CopyMoveAndExceptionSafety) {
+SoACircularBuffer<std::string, int> buffer(3);
+for (int i = 0; i < 5; ++i) {
+buffer.push(std::string(30, static_cast<char>('a' + i)), i);
+}
+SoACircularBuffer<std::string, int> copy(buffer);
+SoACircularBuffer<std::string, int> moved(std::move(buffer));
+EXPECT_TRUE(buffer.empty());
+EXPECT_EQ(column_values(copy.column<0>()), column_values(moved.column<0>()));
+EXPECT_EQ(copy.overflow_count(), 2u);
+buffer = copy;
+EXPECT_EQ(column_values(buffer.column<1>()), (std::vector<int>{2, 3, 4}));
+
+SoACircularBuffer<std::string, Throwing> guarded(2);
+const Throwing bad(-1);
+EXPECT_THROW(guarded.push(std::string("leak"), bad), std::runtime_error);
+EXPECT_TRUE(guarded.empty());
+const Throwing good(1);
+EXPECT_TRUE(guarded.push(std::string("kept"), good));
+EXPECT_EQ(std::get<0>(guarded.front()), "kept");
+}
+
+TEST(SoACircularBufferTest, CopyFromMovedFromBuffer) {
+SoACircularBuffer<std::string, int> source(2);
+source.push(std::string("kept"), 1);
+SoACircularBuffer<std::string, int> moved(std::move(source));
+
+SoACircularBuffer<std::string, int> copy(source);
+EXPECT_TRUE(copy.empty());
+EXPECT_EQ(copy.capacity(), 0u);
+
+SoACircularBuffer<std::string, int> target(4);
+target.push(std::string("replaced"), 2);
+target = source;
+EXPECT_TRUE(target.empty());
+EXPECT_EQ(target.capacity(), 0u);
+
+target = moved;
+EXPECT_EQ(target.size(), 1u);
+EXPECT_EQ(std::get<0>(target.front()), "kept");
+}
@@ -0,0 +1,109 @@
+#include "spsc_circular_buffer.hpp"
+#include "buffer_kernels.hpp"
+#include "gtest/gtest.h"
+#include <string>
+#include <thread>
+
+
+TEST(SpscCircularBufferTest, Constructor) {
+SpscCircularBuffer<int> buffer(4);
+
+EXPECT_EQ(buffer.capacity(), 4);
+EXPECT_TRUE(buffer.empty());
+EXPECT_FALSE(buffer.full());
+EXPECT_EQ(buffer.size(), 0);
+EXPECT_THROW(SpscCircularBuffer<int>(0), std::invalid_argument);
+}
+
+TEST(SpscCircularBufferTest, TryPushRejectsWhenFull) {
+SpscCircularBuffer<int> buffer(2);
+
+EXPECT_TRUE(buffer.try_push(1));
+EXPECT_TRUE(buffer.try_push(2));
+EXPECT_TRUE(buffer.full());
+EXPECT_FALSE(buffer.try_push(3));
+EXPECT_EQ(buffer.size(), 2);
+}
+
+TEST(SpscCircularBufferTest, TryPopOrder) {
+SpscCircularBuffer<int> buffer(3);
+int value = 0;
+
+EXPECT_FALSE(buffer.try_pop(value));
+
+for (int i = 0; i < 10; ++i) {
+EXPECT_TRUE(buffer.try_push(i));
+EXPECT_TRUE(buffer.try_pop(value));
+EXPECT_EQ(value, i);
+}
+EXPECT_TRUE(buffer.empty());
+}
+
+TEST(SpscCircularBufferTest, FrontAndPop) {
+SpscCircularBuffer<std::string> buffer(2);
+
+EXPECT_EQ(buffer.front(), nullptr);
+EXPECT_THROW(buffer.pop(), std::runtime_error);
+
+EXPECT_TRUE(buffer.try_emplace(3, 'a'));
+ASSERT_NE(buffer.front(), nullptr);
+EXPECT_EQ(*buffer.front(), "aaa");
+
+buffer.pop();
+EXPECT_TRUE(buffer.empty());
+}
+
+TEST(SpscCircularBufferTest, ReadViewAcrossWrap) {
+SpscCircularBuffer<double> buffer(5);
+EXPECT_TRUE(buffer.read_view().empty());
+
+for (int i = 0; i < 4; ++i) {
+EXPECT_TRUE(buffer.try_push(i));
+}
+EXPECT_EQ(buffer.pop_n(3), 3u);
+for (int i = 4; i < 8; ++i) {
+EXPECT_TRUE(buffer.try_push(i));
+}
+
+const auto view = buffer.read_view();
+const auto [first, second] = view.segments();
+EXPECT_EQ(view.size(), 5u);
+EXPECT_EQ(first.size(), 3u);
+EXPECT_EQ(second.size(), 2u);
+for (std::size_t i = 0; i < view.size(); ++i) {
+EXPECT_EQ(view[i], static_cast<double>(i + 3));
+}
+EXPECT_THROW((void)view[5], std::out_of_range);
+EXPECT_DOUBLE_EQ(BufferKernels::sum(view), 3.0 + 4.0 + 5.0 + 6.0 + 7.0);
+
+EXPECT_EQ(buffer.pop_n(10), 5u);
+EXPECT_TRUE(buffer.empty());
+EXPECT_TRUE(buffer.read_view().empty());
+}
+
+TEST(SpscCircularBufferTest, ProducerConsumerThreads) {
+SpscCircularBuffer<int> buffer(64);
+const int count = 200000;
+
+std::thread producer([&buffer] {
+for (int i = 0; i < count; ++i) {
+while (!buffer.try_push(i)) {
+std::this_thread::yield();
+}
+}
+});
+
+int expected = 0;
+int value = 0;
+while (expected < count) {
+if (buffer.try_pop(value)) {
+ASSERT_EQ(value, expected);
+++expected;
+} else {
+std::this_thread::yield();
+}
+}
+
+producer.join();
+EXPECT_TRUE(buffer.empty());
+}
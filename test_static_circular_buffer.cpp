@@ -0,0 +1,152 @@
+#include "static_circular_buffer.hpp"
+#include "buffer_kernels.hpp"
+#include "gtest/gtest.h"
+#include <array>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+
+    constexpr int constexpr_sum() {
+        StaticCircularBuffer<int, 4> buffer;
+        for (int i = 1; i <= 6; ++i) {
+            buffer.push(i);
+        }
+        buffer.pop();
+        buffer.emplace(10);
+        int sum = 0;
+        for (int value : buffer) {
+            sum += value;
+        }
+        return sum + static_cast<int>(buffer.overflow_count()) * 100;
+    }
+
+    constexpr bool constexpr_linearize() {
+        StaticCircularBuffer<std::string, 5, RejectNewest> buffer;
+        for (int i = 0; i < 5; ++i) {
+            buffer.push(std::string(1, static_cast<char>('a' + i)));
+        }
+        buffer.pop_n(3);
+        buffer.push("f");
+        buffer.push("g");
+        const std::string* data = buffer.linearize();
+        return buffer.is_linearized() && data == &buffer.front() && buffer[0] == "d" && buffer[3] == "g" &&
+               buffer.push("h") && !buffer.push("x");
+    }
+
+    template<typename Buffer>
+    std::vector<std::decay_t<decltype(*std::declval<const Buffer&>().begin())>> contents(const Buffer& buffer) {
+        return {buffer.begin(), buffer.end()};
+    }
+
+}
+
+
+TEST(StaticCircularBufferTest, UsableInConstantExpressions) {
+static_assert(constexpr_sum() == 4 + 5 + 6 + 10 + 200);
+static_assert(constexpr_linearize());
+static_assert(StaticCircularBuffer<double, 16>::capacity() == 16);
+static_assert(sizeof(StaticCircularBuffer<int, 64>) < 64 * sizeof(int) + 32);
+static_assert(std::is_trivially_destructible_v<StaticCircularBuffer<int, 8>>);
+
+constexpr StaticCircularBuffer<int, 3> constant{1, 2, 3, 4};
+static_assert(constant.front() == 2 && constant.back() == 4 && constant[1] == 3);
+EXPECT_EQ(contents(constant), (std::vector<int>{2, 3, 4}));
+}
+
+TEST(StaticCircularBufferTest, OverflowPolicies) {
+StaticCircularBuffer<int, 3> overwrite;
+StaticCircularBuffer<int, 3, RejectNewest> reject;
+StaticCircularBuffer<int, 3, DropNewest> drop;
+for (int i = 0; i < 5; ++i) {
+EXPECT_TRUE(overwrite.push(i));
+EXPECT_EQ(reject.push(i), i < 3);
+EXPECT_EQ(drop.emplace(i), i < 3);
+}
+EXPECT_EQ(contents(overwrite), (std::vector<int>{2, 3, 4}));
+EXPECT_EQ(contents(reject), (std::vector<int>{0, 1, 2}));
+EXPECT_EQ(contents(drop), (std::vector<int>{0, 1, 2}));
+EXPECT_EQ(overwrite.overflow_count(), 2u);
+EXPECT_EQ(reject.overflow_count(), 0u);
+EXPECT_EQ(drop.overflow_count(), 2u);
+}
+
+TEST(StaticCircularBufferTest, MatchesDynamicBufferAcrossWrap) {
+StaticCircularBuffer<std::string, 7> fixed;
+CircularBuffer<std::string> dynamic(7);
+std::vector<std::string> batch;
+for (int round = 0; round < 40; ++round) {
+const std::string value = std::to_string(round);
+if (round % 5 == 0) {
+batch.assign(static_cast<std::size_t>(round % 9), value);
+EXPECT_EQ(fixed.push_range(batch.begin(), batch.end()), dynamic.push_range(batch.begin(), batch.end()));
+} else if (round % 7 == 0) {
+EXPECT_EQ(fixed.pop_n(3), dynamic.pop_n(3));
+} else {
+fixed.push(value);
+dynamic.push(value);
+}
+EXPECT_EQ(contents(fixed), contents(dynamic));
+EXPECT_EQ(fixed.array_one().second, dynamic.array_one().second);
+EXPECT_EQ(fixed.overflow_count(), dynamic.overflow_count());
+}
+
+std::vector<std::string> drained(4);
+EXPECT_EQ(static_cast<std::size_t>(fixed.pop_into(drained.begin(), 4) - drained.begin()), 4u);
+dynamic.pop_into(drained.begin(), 4);
+EXPECT_EQ(contents(fixed), contents(dynamic));
+}
+
+TEST(StaticCircularBufferTest, LinearizeAndSegments) {
+for (std::size_t shift = 0; shift < 8; ++shift) {
+for (std::size_t count = 0; count <= 8; ++count) {
+StaticCircularBuffer<std::unique_ptr<int>, 8> buffer;
+for (std::size_t i = 0; i < shift; ++i) {
+buffer.emplace(nullptr);
+}
+buffer.pop_n(shift);
+for (std::size_t i = 0; i < count; ++i) {
+buffer.emplace(std::make_unique<int>(static_cast<int>(i)));
+}
+const auto [first, second] = buffer.segments();
+EXPECT_EQ(first.size() + second.size(), count);
+auto* data = buffer.linearize();
+EXPECT_TRUE(buffer.is_linearized());
+for (std::size_t i = 0; i < count; ++i) {
+EXPECT_EQ(*data[i], static_cast<int>(i));
+}
+}
+}
+}
+
+TEST(StaticCircularBufferTest, CopyMoveAndKernels) {
+StaticCircularBuffer<double, 64> buffer;
+std::array<double, 100> values{};
+std::iota(values.begin(), values.end(), 0.0);
+EXPECT_EQ(buffer.write(values), 100u);
+EXPECT_DOUBLE_EQ(BufferKernels::sum(buffer), std::accumulate(values.begin() + 36, values.end(), 0.0));
+
+StaticCircularBuffer<double, 64> copy(buffer);
+StaticCircularBuffer<double, 64> moved(std::move(buffer));
+EXPECT_TRUE(buffer.empty());
+EXPECT_EQ(contents(copy), contents(moved));
+buffer = copy;
+EXPECT_EQ(contents(buffer), contents(copy));
+
+std::array<double, 10> out{};
+EXPECT_EQ(moved.read(out), 10u);
+EXPECT_EQ(out.front(), 36.0);
+EXPECT_EQ(moved.size(), 54u);
+}
+
+TEST(StaticCircularBufferTest, RejectsInvalidAccess) {
+StaticCircularBuffer<int, 2> buffer;
+EXPECT_THROW(buffer.front(), std::runtime_error);
+EXPECT_THROW(buffer.back(), std::runtime_error);
+EXPECT_THROW(buffer.pop(), std::runtime_error);
+buffer.push(1);
+EXPECT_THROW(buffer[1], std::out_of_range);
+EXPECT_EQ(buffer[0], 1);
+}
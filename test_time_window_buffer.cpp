@@ -0,0 +1,183 @@
+#include "time_window_buffer.hpp"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using namespace std::chrono_literals;
+using Window = TimeWindowBuffer<int>;
+
+Window::time_point at(std::chrono::milliseconds offset) {
+    return Window::time_point(offset);
+}
+
+std::vector<int> values(const Window::range_type& range) {
+    std::vector<int> result;
+    for (const auto& part : {range.first, range.second}) {
+        for (const auto& entry : part) {
+            result.push_back(entry.value);
+        }
+    }
+    return result;
+}
+
+template<typename T>
+struct CountingAllocator {
+    using value_type = T;
+
+    explicit CountingAllocator(std::size_t* bytes) : bytes(bytes) {}
+    template<typename U>
+    CountingAllocator(const CountingAllocator<U>& other) : bytes(other.bytes) {}
+
+    T* allocate(std::size_t count) {
+        *bytes += count * sizeof(T);
+        return std::allocator<T>().allocate(count);
+    }
+
+    void deallocate(T* pointer, std::size_t count) {
+        *bytes -= count * sizeof(T);
+        std::allocator<T>().deallocate(pointer, count);
+    }
+
+    friend bool operator==(const CountingAllocator& lhs, const CountingAllocator& rhs) {
+        return lhs.bytes == rhs.bytes;
+    }
+    friend bool operator!=(const CountingAllocator& lhs, const CountingAllocator& rhs) {
+        return lhs.bytes != rhs.bytes;
+    }
+
+    std::size_t* bytes;
+};
+
+struct MoveCounter {
+    explicit MoveCounter(int* moves) : moves(moves) {}
+    MoveCounter(MoveCounter&& other) noexcept : moves(other.moves) { ++*moves; }
+    MoveCounter& operator=(MoveCounter&& other) noexcept {
+        moves = other.moves;
+        ++*moves;
+        return *this;
+    }
+
+    int* moves;
+};
+
+}
+
+
+TEST(TimeWindowBufferTest, EvictsByAgeOnPush) {
+Window window(100ms, 2);
+window.push(at(0ms), 0);
+window.push(at(50ms), 1);
+window.push(at(100ms), 2);
+EXPECT_EQ(window.size(), 3u);
+EXPECT_EQ(window.front().value, 0);
+
+window.push(at(151ms), 3);
+EXPECT_EQ(window.size(), 2u);
+EXPECT_EQ(window.front().value, 2);
+EXPECT_EQ(window.back().value, 3);
+EXPECT_EQ(window[1].time, at(151ms));
+
+window.push(at(1000ms), 4);
+EXPECT_EQ(window.size(), 1u);
+EXPECT_EQ(window.front().value, 4);
+}
+
+TEST(TimeWindowBufferTest, GrowsWithBurstsAndShrinks) {
+using CountingWindow = TimeWindowBuffer<int, Window::clock, CountingAllocator<int>>;
+std::size_t bytes = 0;
+CountingWindow window(1s, 4, CountingWindow::allocator_type(&bytes));
+for (int i = 0; i < 1000; ++i) {
+window.push(at(std::chrono::milliseconds(i / 10)), i);
+}
+EXPECT_EQ(window.size(), 1000u);
+EXPECT_GE(window.capacity(), 1000u);
+
+window.push(at(1050ms), 1000);
+EXPECT_EQ(window.front().time, at(50ms));
+const std::size_t grown = bytes;
+window.shrink_to_fit();
+EXPECT_EQ(window.capacity(), window.size());
+EXPECT_EQ(bytes, window.capacity() * sizeof(CountingWindow::Entry));
+EXPECT_LT(bytes, grown);
+EXPECT_EQ(window.back().value, 1000);
+}
+
+TEST(TimeWindowBufferTest, TrimOlderThan) {
+Window window(1s);
+for (int i = 0; i < 10; ++i) {
+window.push(at(std::chrono::milliseconds(i * 10)), i);
+}
+EXPECT_EQ(window.trim_older_than(at(35ms)), 4u);
+EXPECT_EQ(window.front().value, 4);
+EXPECT_EQ(window.trim_older_than(at(35ms)), 0u);
+EXPECT_EQ(window.trim_older_than(at(10s)), 6u);
+EXPECT_TRUE(window.empty());
+}
+
+TEST(TimeWindowBufferTest, RangeQueriesAcrossWrap) {
+Window window(100ms, 8);
+for (int i = 0; i < 20; ++i) {
+window.push(at(std::chrono::milliseconds(i * 10)), i);
+}
+EXPECT_LE(window.capacity(), 16u);
+EXPECT_EQ(window.front().value, 9);
+
+EXPECT_EQ(window.lower_bound(at(0ms)), 0u);
+EXPECT_EQ(window.lower_bound(at(125ms)), 4u);
+EXPECT_EQ(window.lower_bound(at(130ms)), 4u);
+EXPECT_EQ(window.upper_bound(at(130ms)), 5u);
+EXPECT_EQ(window.lower_bound(at(1s)), window.size());
+
+EXPECT_EQ(values(window.range(at(120ms), at(170ms))), (std::vector<int>{12, 13, 14, 15, 16}));
+EXPECT_EQ(values(window.range(at(0ms), at(1s))), (std::vector<int>{9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19}));
+EXPECT_TRUE(values(window.range(at(171ms), at(179ms))).empty());
+EXPECT_TRUE(values(window.range(at(170ms), at(120ms))).empty());
+EXPECT_EQ(values(window.since(at(175ms))), (std::vector<int>{18, 19}));
+
+for (int i = 0; i <= 20; ++i) {
+const auto first = at(std::chrono::milliseconds(90 + i * 5));
+const auto last = first + 37ms;
+std::vector<int> expected;
+for (const auto& entry : window) {
+if (entry.time >= first && entry.time < last) {
+expected.push_back(entry.value);
+}
+}
+EXPECT_EQ(values(window.range(first, last)), expected);
+}
+}
+
+TEST(TimeWindowBufferTest, RejectsInvalidInput) {
+EXPECT_THROW(Window(0ms), std::invalid_argument);
+Window window(1s);
+window.push(at(10ms), 1);
+window.push(at(10ms), 2);
+EXPECT_THROW(window.push(at(5ms), 3), std::invalid_argument);
+EXPECT_EQ(window.size(), 2u);
+window.clear();
+EXPECT_THROW(window.front(), std::runtime_error);
+}
+
+TEST(TimeWindowBufferTest, StoresMovedAndEmplacedValues) {
+TimeWindowBuffer<std::string> window(1s);
+std::string text = "event";
+window.push(TimeWindowBuffer<std::string>::time_point(1s), std::move(text));
+window.emplace(TimeWindowBuffer<std::string>::time_point(2s), 3, 'x');
+EXPECT_EQ(window.front().value, "event");
+EXPECT_EQ(window.back().value, "xxx");
+EXPECT_EQ(window.size(), 2u);
+}
+
+TEST(TimeWindowBufferTest, EmplaceConstructsInPlace) {
+TimeWindowBuffer<MoveCounter> window(1s, 4);
+int moves = 0;
+window.emplace(TimeWindowBuffer<MoveCounter>::time_point(1s), &moves);
+window.emplace(TimeWindowBuffer<MoveCounter>::time_point(2s), &moves);
+EXPECT_EQ(window.size(), 2u);
+EXPECT_EQ(moves, 0);
+}
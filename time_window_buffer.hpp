@@ -0,0 +1,228 @@
+#ifndef TIME_WINDOW_BUFFER_HPP
+#define TIME_WINDOW_BUFFER_HPP
+
+#include "circular_buffer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+template<typename T, typename Clock = std::chrono::steady_clock, typename Allocator = std::allocator<T>>
+class TimeWindowBuffer {
+public:
+    using clock = Clock;
+    using time_point = typename Clock::time_point;
+    using duration = typename Clock::duration;
+
+    struct Entry {
+        template<typename... Args>
+        explicit Entry(time_point time, Args&&... args) : time(time), value(std::forward<Args>(args)...) {}
+
+        time_point time;
+        T value;
+    };
+
+    using value_type = Entry;
+    using reference = Entry&;
+    using const_reference = const Entry&;
+    using size_type = std::size_t;
+    using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+    using buffer_type = CircularBuffer<Entry, ModuloCapacity, allocator_type, GrowCapacity>;
+    using const_iterator = typename buffer_type::const_iterator;
+    using range_type = std::pair<std::span<const Entry>, std::span<const Entry>>;
+
+    explicit TimeWindowBuffer(duration window, size_type initial_capacity = 64,
+                              const allocator_type& allocator = allocator_type());
+
+    const_reference front() const;
+    const_reference back() const;
+    const_reference operator[](size_type index) const;
+
+    [[nodiscard]] bool empty() const noexcept;
+    [[nodiscard]] size_type size() const noexcept;
+    [[nodiscard]] size_type capacity() const noexcept;
+    [[nodiscard]] duration window() const noexcept;
+
+    void push(time_point time, const T& value);
+    void push(time_point time, T&& value);
+    template<typename... Args>
+    void emplace(time_point time, Args&&... args);
+
+    size_type trim_older_than(time_point cutoff);
+    void clear() noexcept;
+    void shrink_to_fit();
+
+    [[nodiscard]] size_type lower_bound(time_point time) const;
+    [[nodiscard]] size_type upper_bound(time_point time) const;
+    [[nodiscard]] range_type range(time_point first, time_point last) const;
+    [[nodiscard]] range_type since(time_point first) const;
+
+    const_iterator begin() const noexcept;
+    const_iterator end() const noexcept;
+
+private:
+    buffer_type buffer_;
+    duration window_;
+
+    void prepare(time_point time);
+    template<typename Compare>
+    size_type partition_point(Compare compare) const;
+    range_type slice(size_type first, size_type last) const;
+};
+
+
+template<typename T, typename Clock, typename Allocator>
+TimeWindowBuffer<T, Clock, Allocator>::TimeWindowBuffer(duration window, size_type initial_capacity,
+                                                       const allocator_type& allocator)
+        : buffer_(initial_capacity, allocator)
+        , window_(window) {
+    if (window <= duration::zero()) {
+        throw std::invalid_argument("Window must be greater than 0");
+    }
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::const_reference TimeWindowBuffer<T, Clock, Allocator>::front() const {
+    return buffer_.front();
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::const_reference TimeWindowBuffer<T, Clock, Allocator>::back() const {
+    return buffer_.back();
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::const_reference
+TimeWindowBuffer<T, Clock, Allocator>::operator[](size_type index) const {
+    return buffer_[index];
+}
+
+template<typename T, typename Clock, typename Allocator>
+bool TimeWindowBuffer<T, Clock, Allocator>::empty() const noexcept {
+    return buffer_.empty();
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::size_type TimeWindowBuffer<T, Clock, Allocator>::size() const noexcept {
+    return buffer_.size();
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::size_type
+TimeWindowBuffer<T, Clock, Allocator>::capacity() const noexcept {
+    return buffer_.capacity();
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::duration
+TimeWindowBuffer<T, Clock, Allocator>::window() const noexcept {
+    return window_;
+}
+
+template<typename T, typename Clock, typename Allocator>
+void TimeWindowBuffer<T, Clock, Allocator>::prepare(time_point time) {
+    if (!buffer_.empty() && time < buffer_.back().time) {
+        throw std::invalid_argument("Timestamps must be non-decreasing");
+    }
+    trim_older_than(time - window_);
+}
+
+template<typename T, typename Clock, typename Allocator>
+void TimeWindowBuffer<T, Clock, Allocator>::push(time_point time, const T& value) {
+    prepare(time);
+    buffer_.emplace(time, value);
+}
+
+template<typename T, typename Clock, typename Allocator>
+void TimeWindowBuffer<T, Clock, Allocator>::push(time_point time, T&& value) {
+    prepare(time);
+    buffer_.emplace(time, std::move(value));
+}
+
+template<typename T, typename Clock, typename Allocator>
+template<typename... Args>
+void TimeWindowBuffer<T, Clock, Allocator>::emplace(time_point time, Args&&... args) {
+    prepare(time);
+    buffer_.emplace(time, std::forward<Args>(args)...);
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::size_type
+TimeWindowBuffer<T, Clock, Allocator>::trim_older_than(time_point cutoff) {
+    return buffer_.pop_n(lower_bound(cutoff));
+}
+
+template<typename T, typename Clock, typename Allocator>
+void TimeWindowBuffer<T, Clock, Allocator>::clear() noexcept {
+    buffer_.clear();
+}
+
+template<typename T, typename Clock, typename Allocator>
+void TimeWindowBuffer<T, Clock, Allocator>::shrink_to_fit() {
+    buffer_.resize(std::max<size_type>(buffer_.size(), 1));
+    buffer_.shrink_to_fit();
+}
+
+template<typename T, typename Clock, typename Allocator>
+template<typename Compare>
+typename TimeWindowBuffer<T, Clock, Allocator>::size_type
+TimeWindowBuffer<T, Clock, Allocator>::partition_point(Compare compare) const {
+    const auto [first, second] = buffer_.segments();
+    if (!first.empty() && !compare(first.back())) {
+        return static_cast<size_type>(std::partition_point(first.begin(), first.end(), compare) - first.begin());
+    }
+    return first.size() +
+           static_cast<size_type>(std::partition_point(second.begin(), second.end(), compare) - second.begin());
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::size_type
+TimeWindowBuffer<T, Clock, Allocator>::lower_bound(time_point time) const {
+    return partition_point([time](const Entry& entry) { return entry.time < time; });
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::size_type
+TimeWindowBuffer<T, Clock, Allocator>::upper_bound(time_point time) const {
+    return partition_point([time](const Entry& entry) { return !(time < entry.time); });
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::range_type
+TimeWindowBuffer<T, Clock, Allocator>::slice(size_type first, size_type last) const {
+    const auto [one, two] = buffer_.segments();
+    last = std::max(first, last);
+    const size_type split = one.size();
+    return {one.subspan(std::min(first, split), std::min(last, split) - std::min(first, split)),
+            two.subspan(std::max(first, split) - split, std::max(last, split) - std::max(first, split))};
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::range_type
+TimeWindowBuffer<T, Clock, Allocator>::range(time_point first, time_point last) const {
+    return slice(lower_bound(first), lower_bound(last));
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::range_type
+TimeWindowBuffer<T, Clock, Allocator>::since(time_point first) const {
+    return slice(lower_bound(first), size());
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::const_iterator
+TimeWindowBuffer<T, Clock, Allocator>::begin() const noexcept {
+    return buffer_.begin();
+}
+
+template<typename T, typename Clock, typename Allocator>
+typename TimeWindowBuffer<T, Clock, Allocator>::const_iterator
+TimeWindowBuffer<T, Clock, Allocator>::end() const noexcept {
+    return buffer_.end();
+}
+
+#endif